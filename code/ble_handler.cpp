@@ -1,10 +1,19 @@
 /*
  * BLE Handler - Manages BLE connection and callbacks
+ *
+ * Callbacks run outside loop() (BLE host task), so they only copy what they
+ * need into an event and push it to the event queue. processBleEvents()
+ * applies the events to the notification queue and display state from
+ * loop(), once per tick.
  */
 
 #include "ble_handler.h"
+#include "event_queue.h"
 #include "notification_queue.h"
+#include "text_layout.h"
+#include "latency_trace.h"
 #include "weather_cache.h"
+#include "device_state.h"
 #include "config.h"
 
 // External objects
@@ -14,8 +23,10 @@ extern DisplayMode currentMode;
 extern bool displayNeedsUpdate;
 
 void initBLE() {
+  initEventQueue();
   chronos.setConnectionCallback(onConnection);
   chronos.setNotificationCallback(onNotification);
+  chronos.setConfigurationCallback(onConfiguration);
   chronos.setNotifyBattery(true); // Enable phone battery notifications
   chronos.begin();
 }
@@ -25,11 +36,69 @@ void onConnection(bool connected) {
     chronos.syncRequest(); // Request time sync
   }
   // LED removed for lower power consumption
+  BleEvent event;
+  event.type = EVENT_CONNECTION;
+  event.connected = connected;
+  pushEvent(event);
 }
 
 void onNotification(Notification notification) {
-  addNotification(notification);
-  currentMode = MODE_NOTIFICATION;
-  displayNeedsUpdate = true;
+  // Truncate into the event's fixed buffers here, on the BLE side, so the
+  // loop never touches the library's Strings
+  BleEvent event;
+  event.type = EVENT_NOTIFICATION;
+  event.receivedUs = micros(); // Start of the notification-to-glass trace
+  normalizeText(event.app, sizeof(event.app), notification.app.c_str());
+  normalizeText(event.title, sizeof(event.title), notification.title.c_str());
+  // The title is only the header; a title-only notification shows it in full
+  // as the body, so pick the body before event.title cuts it short
+  const String& body = notification.message.length() > 0 ? notification.message : notification.title;
+  normalizeText(event.message, sizeof(event.message), body.c_str(), &event.messageTruncated);
+  pushEvent(event);
 }
 
+void onConfiguration(Config config, uint32_t a, uint32_t b) {
+  if (config == CF_NAV_DATA || config == CF_NAV_ICON) {
+    // The icon arrives in chunks; a is the chunk position and b the CRC
+    // the library keys it by, so only the last chunk marks it usable
+    BleEvent event;
+    event.type = EVENT_NAVIGATION;
+    event.iconCrc = (config == CF_NAV_ICON && a == NAV_ICON_LAST_CHUNK) ? b : 0;
+    pushEvent(event);
+  } else if (config == CF_WEATHER) {
+    BleEvent event;
+    event.type = EVENT_WEATHER;
+    pushEvent(event);
+  }
+}
+
+void processBleEvents() {
+  // Bounded drain: a burst larger than the queue waits for the next tick
+  BleEvent event;
+  for (int i = 0; i < EVENT_QUEUE_SIZE && popEvent(event); i++) {
+    switch (event.type) {
+      case EVENT_NOTIFICATION:
+        addNotification(event.app, event.title, event.message, event.messageTruncated);
+        traceNotificationIngested(event.receivedUs);
+        currentMode = MODE_NOTIFICATION;
+        displayNeedsUpdate = true;
+        break;
+      case EVENT_CONNECTION:
+        displayNeedsUpdate = true;
+        break;
+      case EVENT_NAVIGATION:
+        navigationChanged = true;
+        if (event.iconCrc != 0) {
+          navIconReadyCrc = event.iconCrc;
+        }
+        displayNeedsUpdate = true;
+        break;
+      case EVENT_WEATHER:
+        // Refresh the offline cache only when new weather data arrives
+        updateWeatherCache();
+        weatherChanged = true;
+        displayNeedsUpdate = true;
+        break;
+    }
+  }
+}
@@ -20,6 +20,8 @@ extern bool displayNeedsUpdate;
 void initBLE();
 void onConnection(bool connected);
 void onNotification(Notification notification);
+void onConfiguration(Config config, uint32_t a, uint32_t b);
+void processBleEvents(); // Call from loop() before updateDisplay()
 
 #endif // BLE_HANDLER_H
 
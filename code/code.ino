@@ -9,13 +9,17 @@
  * Modular architecture:
  * - config.h: Configuration and constants
  * - display_manager: Display mode management
+ * - display_flush: Differential framebuffer transfer to the OLED
+ * - frame_scheduler: Per-face frame deadlines and render budgets
  * - display_time: Time display functions
  * - display_weather: Weather display functions
  * - display_notification: Notification display functions
  * - display_navigation: Navigation display functions
  * - notification_queue: Notification queue management
- * - weather_cache: Weather data caching
+ * - weather_cache: Weather data caching (persisted to NVS)
  * - ble_handler: BLE connection and callbacks
+ * - event_queue: Lock-free BLE callback -> loop event handoff and loop wakeup
+ * - power_manager: Automatic light sleep between loop ticks
  */
 
 #include <ChronosESP32.h>
@@ -27,9 +31,16 @@
 
 #include "config.h"
 #include "display_manager.h"
+#include "display_flush.h"
+#include "frame_scheduler.h"
 #include "notification_queue.h"
 #include "weather_cache.h"
+#include "device_state.h"
 #include "ble_handler.h"
+#include "event_queue.h"
+#include "power_manager.h"
+#include "profiler.h"
+#include "latency_trace.h"
 
 // Global objects
 Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
@@ -37,8 +48,13 @@ ChronosESP32 chronos(DEVICE_NAME);
 ESP32Time rtc;
 
 void setup() {
-  // Set CPU frequency to 80MHz for lower power consumption and heat
-  setCpuFrequencyMhz(80);
+  // Idle at the lowest clock and light-sleep while loop() waits for events;
+  // frames boost to CPU_FREQ_MAX_MHZ (falls back to a fixed CPU_FREQ_MHZ)
+  initPowerManagement();
+  // Stage histograms over Serial (compiled out unless PROFILE_STAGES)
+  PROFILE_INIT();
+  // Notification-to-glass latency, queryable with "lat" over Serial
+  initLatencyTrace();
 
   // Initialize watchdog timer
   esp_task_wdt_config_t wdt_config = {
@@ -55,6 +71,7 @@ void setup() {
   if(!display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
     for(;;);
   }
+  initDisplayFlush();
 
   display.clearDisplay();
   display.setTextSize(1);
@@ -62,12 +79,13 @@ void setup() {
   display.setCursor(0, 0);
   display.println("InfoView");
   display.println("Initializing...");
-  display.display();
+  flushDisplay();
 
   // Initialize modules
   initDisplayManager();
   initNotificationQueue();
   initWeatherCache();
+  initDeviceState();
   initBLE();
 
   display.clearDisplay();
@@ -75,31 +93,40 @@ void setup() {
   display.println("InfoView Ready!");
   display.println("Waiting for");
   display.println("Chronos app...");
-  display.display();
+  flushDisplay();
 }
 
 void loop() {
   // Feed watchdog timer
   esp_task_wdt_reset();
+  PROFILE_BEGIN(loopStart);
 
   // Handle Chronos library routine functions
+  PROFILE_BEGIN(chronosStart);
   chronos.loop();
-  
-  // Update weather cache when new data arrives
-  if (chronos.getWeatherCount() > 0) {
-    // Check if this is new data (different from cache or cache is invalid)
-    // Get weather once to avoid multiple calls
-    Weather currentWeather = chronos.getWeatherAt(0);
-    if (!cachedWeather.valid || 
-        cachedWeather.temp != currentWeather.temp ||
-        cachedWeather.icon != currentWeather.icon) {
-      updateWeatherCache();
-    }
-  }
+  PROFILE_END(chronosStart, PROFILE_CHRONOS);
+
+  // Apply events queued by BLE callbacks since the last tick (notifications,
+  // connection, navigation and weather updates)
+  PROFILE_BEGIN(eventsStart);
+  processBleEvents();
+  PROFILE_END(eventsStart, PROFILE_EVENTS);
+
+  // Snapshot clock, link, weather and navigation once for this tick
+  updateDeviceState();
 
   // Update display
   updateDisplay();
+  PROFILE_END(loopStart, PROFILE_LOOP);
+  PROFILE_DUMP(millis());
+
+  // Fold finished latency traces and answer Serial queries
+  pollLatencyTrace();
+
+  // Persist the weather cache once a burst of updates has settled
+  pollWeatherCache(millis());
 
-  // Reduced delay for smoother updates (50ms = 20fps max refresh rate)
-  delay(50);
+  // Sleep until a BLE event arrives, the current face's next frame is due
+  // or the face rotation/notification timer fires (at most LOOP_MAX_SLEEP)
+  waitForEvents(msUntilNextUpdate(millis()));
 }
@@ -16,23 +16,112 @@
 #define SCL_PIN 8
 // LED_PIN removed - not used for lower power consumption
 
+// Display flush configuration (differential SSD1306 transfers)
+#define DISPLAY_I2C_CHUNK 128 // Bytes per I2C transaction (ESP32 Wire buffer size)
+#define FLUSH_WINDOW_OVERHEAD 10 // Bus bytes to set up one address window
+#define FLUSH_MAX_WINDOWS 24 // More changed runs than this falls back to a full frame
+#ifndef DISPLAY_ASYNC_FLUSH
+#define DISPLAY_ASYNC_FLUSH 1 // Stream frames from a dedicated task while the next one renders
+#endif
+#define DISPLAY_FLUSH_TASK_STACK 3072
+#define DISPLAY_FLUSH_TASK_PRIORITY 2 // Above loopTask so transfers start promptly
+#ifndef DISPLAY_REGION_UPDATES
+#define DISPLAY_REGION_UPDATES 1 // Faces with an update hook redraw and flush only changed cells
+#endif
+
 // Display mode switching intervals
 #define MODE_TIME_DURATION 20000 // 20 seconds for time mode
 #define MODE_WEATHER_DURATION 10000 // 10 seconds for weather mode
 #define MODE_FORECAST_DURATION 10000 // 10 seconds for forecast mode
 #define MODE_EYE_DURATION 15000 // 15 seconds for eye animation mode
+#define EYE_FRAME_INTERVAL 16 // Eye animation step/refresh interval in ms (~60 fps)
+
+// Frame scheduling: per-face refresh interval in ms (0 = redraw only on change)
+#define FRAME_INTERVAL_TIME 1000 // Seconds counter
+#define FRAME_INTERVAL_WEATHER SCROLL_INTERVAL // Scrolling location text
+#define FRAME_INTERVAL_FORECAST 0
+#define FRAME_INTERVAL_NOTIFICATION 0
+#define FRAME_INTERVAL_NAVIGATION 500 // Live distance/ETA
+#define FRAME_INTERVAL_EYE EYE_FRAME_INTERVAL
+// Per-frame render + flush submission budget in microseconds
+#define FRAME_BUDGET_TIME 20000
+#define FRAME_BUDGET_WEATHER 20000
+#define FRAME_BUDGET_FORECAST 30000
+#define FRAME_BUDGET_NOTIFICATION 30000
+#define FRAME_BUDGET_NAVIGATION 20000
+#define FRAME_BUDGET_EYE 8000 // Half a frame at ~60 fps
+#define FRAME_DEADLINE_SLACK 4 // ms a scheduled frame may start late before it counts as missed
+#define LOOP_MAX_SLEEP 250 // Longest idle wait between loop() ticks (chronos.loop() housekeeping)
+
+// Event-driven runtime: loop() blocks until a BLE event, the next frame
+// deadline or the next mode switch, and the CPU light-sleeps in between
+#ifndef LOOP_EVENT_WAIT
+#define LOOP_EVENT_WAIT 1 // Wait on a FreeRTOS event group (0 = plain delay)
+#endif
+#ifndef POWER_LIGHT_SLEEP
+#define POWER_LIGHT_SLEEP 1 // Automatic light sleep via esp_pm while idle
+#endif
+#ifndef POWER_DFS
+#define POWER_DFS 1 // Dynamic frequency scaling: boost only while a frame renders/flushes
+#endif
+#define CPU_FREQ_MAX_MHZ 160 // Render/flush boost
+#define CPU_FREQ_MIN_MHZ 40 // Waiting for events (XTAL, lowest stable clock)
+#define CPU_FREQ_MHZ 80 // Fixed clock when DFS is disabled or unsupported
+#define NAV_CLASSIFY_CACHE 4 // Direction texts whose icon is remembered (nav_classifier.h)
+#define NAV_PHONE_ICON_W 48 // Side of the turn icon in the Chronos navigation payload
+#define NAV_ICON_LAST_CHUNK 2 // CF_NAV_ICON chunk position that completes the icon
+#define NAV_ICON_CACHE_SIZE 4 // Phone turn icons kept scaled to 32x32 (nav_icon_cache.h)
+
+// Stage profiling (profiler.h): cycle-timed histograms printed over Serial
+#ifndef PROFILE_STAGES
+#define PROFILE_STAGES 0 // 1 = time loop stages; 0 compiles all probes out
+#endif
+#define PROFILE_DUMP_INTERVAL 10000 // ms between histogram dumps
+
+// Notification-to-glass latency tracing (latency_trace.h)
+#ifndef LATENCY_TRACE_SERIAL
+#define LATENCY_TRACE_SERIAL 0 // 1 = answer "lat" queries over Serial; 0 leaves Serial off
+#endif
+#define LATENCY_HISTORY 16 // Recent notifications kept for the query
+#define SERIAL_BAUD 115200 // Profiler and latency query output
+
+// BLE event queue (callbacks -> loop handoff)
+#define EVENT_QUEUE_SIZE 16 // Power of two; events beyond this are dropped and counted
+
+// Text layout configuration (heap-free word wrapping)
+#define TEXT_LAYOUT_MAX_LINES 8 // Most lines a layout can return
+#define TEXT_LAYOUT_BUFFER 192 // Stack buffer for normalized text (more than 5 full lines)
+#define NAV_TEXT_BUFFER 32 // Stack buffer for the navigation ETA text
+
+// Device state snapshot (device_state.h)
+#define NAV_TITLE_MAX 16 // Distance text kept from the phone
+#define WEATHER_CITY_MAX 48 // City name kept from the phone
+#define WEATHER_FORECAST_MAX 4 // Forecast days after today kept for the forecast face
 
 // Notification configuration
-#define MAX_NOTIFICATIONS 4
+#define MAX_NOTIFICATIONS 32 // Ring buffer capacity (oldest dropped on overflow)
+#define NOTIFICATION_APP_MAX 24 // Bytes kept per entry for the app name (incl. terminator)
+#define NOTIFICATION_TITLE_MAX 32 // Bytes kept per entry for the title
 #define NOTIFICATION_DISPLAY_TIME 6000 // 6 seconds
 #define NOTIFICATION_DISPLAY_TIME_NAV 3000 // 3 seconds during navigation
+#define NOTIFICATION_TEXT_MAX 160 // Sanitized message bytes kept per entry (more than 5 full proportional lines)
+#define NOTIFICATION_TEXT_LINES 5 // Message lines on the notification face
+#define NOTIFICATION_TEXT_WIDTH (SCREEN_WIDTH - 4) // 2px margin on each side
+#define NOTIFICATION_RAM_BUDGET 8192 // Static RAM allowed for queue storage (checked at compile time)
 
 // Scrolling configuration
 #define SCROLL_INTERVAL 300 // Scroll every 300ms
 #define SCROLL_PAUSE 1000 // Pause 1 second at start/end
+#define WEATHER_CITY_WIDTH (SCREEN_WIDTH - 4) // Header pixels for the city name before it scrolls
 
 // Weather cache configuration
 #define CACHE_MAX_AGE 3600000 // 1 hour in milliseconds
+#ifndef WEATHER_CACHE_PERSIST
+#define WEATHER_CACHE_PERSIST 1 // Keep the cache in NVS so weather shows right after a reboot
+#endif
+#define WEATHER_CACHE_SETTLE 5000 // Let a burst of weather/forecast/location packets finish before writing
+#define WEATHER_CACHE_WRITE_INTERVAL 300000 // At most one NVS write per 5 minutes (flash wear)
+#define CLOCK_VALID_EPOCH 1609459200 // 2021-01-01; earlier system time means the phone has not set the clock yet
 
 // Watchdog timer configuration
 #define WDT_TIMEOUT_MS 30000 // 30 seconds
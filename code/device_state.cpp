@@ -0,0 +1,227 @@
+/*
+ * Device State - Per-tick snapshot of clock, link, weather and navigation
+ *
+ * Faces used to query ChronosESP32 and ESP32Time themselves: several
+ * localtime conversions per frame, Navigation and Weather copies (with
+ * their Strings) in both the manager and the faces. Instead loop() builds
+ * one DeviceState per tick and every face reads plain fields from it:
+ *
+ *  - clock: one localtime conversion per second, when the epoch changes
+ *  - link: connection and phone battery (plain getters)
+ *  - weather: refreshed when a weather event arrived (or from the persisted
+ *    offline cache at boot); between events only the cache's age is checked
+ *  - navigation: refreshed on navigation events only; a phone-supplied turn
+ *    icon is handed to the icon cache once, when its last chunk has arrived
+ *
+ * ChronosESP32 only returns Navigation and WeatherLocation by value, so each
+ * read copies the library struct (Strings, and the 288-byte icon for
+ * Navigation). Those reads therefore happen only when a callback flagged a
+ * change, never on an idle tick.
+ *
+ * Each StateInput's generation counter increments only when that content
+ * changes, so the display manager can skip faces whose inputs are unchanged.
+ */
+
+#include "device_state.h"
+#include "weather_cache.h"
+#include "notification_queue.h"
+#include "nav_icon_cache.h"
+#include <string.h>
+
+static_assert(sizeof(Navigation::icon) == (NAV_PHONE_ICON_W * NAV_PHONE_ICON_W) / 8,
+              "NAV_PHONE_ICON_W does not match the ChronosESP32 navigation icon");
+
+// External objects
+extern ChronosESP32 chronos;
+extern ESP32Time rtc;
+
+DeviceState deviceState;
+bool navigationChanged = false;
+uint32_t navIconReadyCrc = 0;
+bool weatherChanged = false;
+
+static unsigned long lastEpoch = 0;
+static bool clockValid = false;
+
+// Copy src into a fixed buffer, truncating; returns true if dst changed
+static bool copyField(char* dst, size_t size, const char* src) {
+  char next[TEXT_LAYOUT_BUFFER];
+  size_t n = 0;
+  for (; src[n] && n < size - 1 && n < sizeof(next) - 1; n++) {
+    next[n] = src[n];
+  }
+  next[n] = '\0';
+  if (strcmp(dst, next) == 0) {
+    return false;
+  }
+  memcpy(dst, next, n + 1);
+  return true;
+}
+
+static void updateClock() {
+  unsigned long epoch = rtc.getEpoch();
+  if (clockValid && epoch == lastEpoch) {
+    return;
+  }
+  lastEpoch = epoch;
+  clockValid = true;
+
+  tm now = rtc.getTimeStruct();
+  ClockState& clock = deviceState.clock;
+  if (now.tm_min != clock.minute || now.tm_hour != clock.hour24 || now.tm_mday != clock.day) {
+    deviceState.generations[INPUT_MINUTE]++;
+  }
+  clock.hour24 = now.tm_hour;
+  clock.hour12 = now.tm_hour == 0 ? 12 : (now.tm_hour > 12 ? now.tm_hour - 12 : now.tm_hour);
+  clock.hour = chronos.is24Hour() ? clock.hour24 : clock.hour12;
+  clock.minute = now.tm_min;
+  clock.second = now.tm_sec;
+  clock.day = now.tm_mday;
+  clock.month = now.tm_mon + 1; // tm_mon is 0-11
+  clock.dayOfWeek = now.tm_wday;
+  clock.year = now.tm_year + 1900;
+  deviceState.generations[INPUT_SECOND]++;
+}
+
+static void updateLink() {
+  LinkState& link = deviceState.link;
+  bool connected = chronos.isConnected();
+  int battery = 0;
+  if (connected) {
+    battery = chronos.getPhoneBattery();
+    // Ensure battery level is in valid range (0-100)
+    if (battery < 0) battery = 0;
+    if (battery > 100) battery = 100;
+  }
+  if (connected != link.connected) {
+    link.connected = connected;
+    deviceState.generations[INPUT_CONNECTION]++;
+  }
+  if (battery != link.phoneBattery) {
+    link.phoneBattery = battery;
+    deviceState.generations[INPUT_BATTERY]++;
+  }
+}
+
+static void refreshWeather() {
+  // Build the new contents aside so only real changes bump the generations
+  static WeatherState next;
+  WeatherState& weather = deviceState.weather;
+  memset(&next, 0, sizeof(next));
+  next.valid = weather.valid;
+
+  int count = chronos.getWeatherCount();
+  if (count > 0) {
+    next.live = true;
+    next.current = chronos.getWeatherAt(0);
+    next.forecastCount = min(count - 1, WEATHER_FORECAST_MAX);
+    for (int i = 0; i < next.forecastCount; i++) {
+      next.forecast[i] = chronos.getWeatherAt(i + 1);
+    }
+    WeatherLocation location = chronos.getWeatherLocation();
+    const String& city = location.city.length() > 0 ? location.city : chronos.getWeatherCity();
+    copyField(next.city, sizeof(next.city), city.c_str());
+  } else if (weatherCacheFresh()) {
+    // Disconnected or just rebooted: today, forecast and city from the cache
+    getCachedDay(0, next.current);
+    next.forecastCount = min(cachedWeather.count - 1, WEATHER_FORECAST_MAX);
+    for (int i = 0; i < next.forecastCount; i++) {
+      getCachedDay(i + 1, next.forecast[i]);
+    }
+    copyField(next.city, sizeof(next.city), cachedWeather.city);
+  } else {
+    // Nothing fresh: keep showing what we had until the cache expires
+    next.current = weather.current;
+    next.forecastCount = weather.forecastCount;
+    memcpy(next.forecast, weather.forecast, sizeof(next.forecast));
+    memcpy(next.city, weather.city, sizeof(next.city));
+  }
+  next.cityLength = strlen(next.city);
+
+  if (next.live != weather.live || next.cityLength != weather.cityLength ||
+      memcmp(&next.current, &weather.current, sizeof(next.current)) != 0 ||
+      strcmp(next.city, weather.city) != 0) {
+    deviceState.generations[INPUT_WEATHER]++;
+  }
+  if (next.forecastCount != weather.forecastCount ||
+      memcmp(next.forecast, weather.forecast, sizeof(Weather) * next.forecastCount) != 0) {
+    deviceState.generations[INPUT_FORECAST]++;
+  }
+  weather = next;
+}
+
+static void updateWeather() {
+  if (weatherChanged) {
+    weatherChanged = false;
+    refreshWeather();
+  }
+
+  // Cached data expires after CACHE_MAX_AGE
+  WeatherState& weather = deviceState.weather;
+  bool valid = weather.live || weatherCacheFresh();
+  if (valid != weather.valid) {
+    weather.valid = valid;
+    deviceState.generations[INPUT_WEATHER]++;
+  }
+}
+
+static void updateNavigation() {
+  if (!navigationChanged) {
+    return;
+  }
+  navigationChanged = false;
+
+  Navigation source = chronos.getNavigation();
+  NavState& nav = deviceState.nav;
+  const String& directions = source.directions.length() > 0 ? source.directions : source.title;
+  bool changed = source.active != nav.active;
+  nav.active = source.active;
+  changed |= copyField(nav.title, sizeof(nav.title), source.title.c_str());
+  changed |= copyField(nav.directions, sizeof(nav.directions), directions.c_str());
+  changed |= copyField(nav.duration, sizeof(nav.duration), source.duration.c_str());
+  // Scaled into the icon cache once per distinct icon, keyed by the
+  // library's CRC and only once every chunk is in
+  bool hasIcon = ENABLE_NAVIGATION_FACE && source.hasIcon;
+  uint32_t iconCrc = hasIcon ? nav.iconCrc : 0;
+  if (hasIcon && source.iconCRC != nav.iconCrc && source.iconCRC == navIconReadyCrc) {
+    storeNavIcon(source.icon, source.iconCRC);
+    iconCrc = source.iconCRC;
+  }
+  changed |= hasIcon != nav.hasIcon || iconCrc != nav.iconCrc;
+  nav.hasIcon = hasIcon;
+  nav.iconCrc = iconCrc;
+  if (changed) {
+    deviceState.generations[INPUT_NAV]++;
+  }
+}
+
+void initDeviceState() {
+  memset(&deviceState, 0, sizeof(deviceState));
+  clockValid = false;
+  navigationChanged = true; // First tick reads everything
+  navIconReadyCrc = 0;
+  weatherChanged = true;
+}
+
+void updateDeviceState() {
+  updateClock();
+  updateLink();
+  updateWeather();
+  updateNavigation();
+}
+
+uint32_t inputGeneration(StateInput input) {
+  // The queue can change during updateDisplay() (expiry), after the snapshot
+  if (input == INPUT_NOTIFICATIONS) {
+    return notificationGeneration;
+  }
+  return deviceState.generations[input];
+}
+
+bool weatherAvailable() {
+  return deviceState.weather.valid;
+}
+
+bool forecastAvailable() {
+  return deviceState.weather.valid && deviceState.weather.forecastCount > 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Device State - Per-tick snapshot of clock, link, weather and navigation
+ */
+
+#ifndef DEVICE_STATE_H
+#define DEVICE_STATE_H
+
+#include <Arduino.h>
+#include <ChronosESP32.h>
+#include "config.h"
+
+// Wall clock, converted once per second
+struct ClockState {
+  uint8_t hour;      // Chronos 12/24h setting (as getHourC())
+  uint8_t hour24;    // 0-23, for day/night decisions
+  uint8_t hour12;    // 1-12 (as ESP32Time::getHour())
+  uint8_t minute;
+  uint8_t second;
+  uint8_t day;       // 1-31
+  uint8_t month;     // 1-12
+  uint8_t dayOfWeek; // 0 = Sunday
+  uint16_t year;
+};
+
+// Phone link
+struct LinkState {
+  bool connected;
+  uint8_t phoneBattery; // 0-100, 0 while disconnected
+};
+
+// Current weather (live from the phone or the offline cache) and forecast
+struct WeatherState {
+  bool valid;                             // Something to show
+  bool live;                              // From the phone rather than the cache
+  Weather current;
+  Weather forecast[WEATHER_FORECAST_MAX]; // Days after today
+  uint8_t forecastCount;
+  char city[WEATHER_CITY_MAX];
+  uint8_t cityLength;
+};
+
+// Active route, copied out of the library's Strings
+struct NavState {
+  bool active;
+  char title[NAV_TITLE_MAX];              // Distance to the next maneuver
+  char directions[TEXT_LAYOUT_BUFFER];    // Instruction (falls back to the title)
+  char duration[NAV_TEXT_BUFFER];         // ETA as sent by the phone
+  bool hasIcon;                           // Phone sent its own turn icon
+  uint32_t iconCrc;                       // nav_icon_cache.h key of that icon
+};
+
+// Inputs a face can depend on (FaceDescriptor::inputs); each has a
+// generation counter that increments only when that content changes
+enum StateInput : uint8_t {
+  INPUT_SECOND,
+  INPUT_MINUTE,
+  INPUT_BATTERY,
+  INPUT_CONNECTION,
+  INPUT_WEATHER,       // Current conditions, city, validity
+  INPUT_FORECAST,
+  INPUT_NAV,
+  INPUT_NOTIFICATIONS, // Owned by the notification queue
+  INPUT_COUNT
+};
+
+#define INPUT_BIT(input) (1u << (input))
+
+struct DeviceState {
+  ClockState clock;
+  LinkState link;
+  WeatherState weather;
+  NavState nav;
+  uint32_t generations[INPUT_COUNT];
+};
+
+extern DeviceState deviceState;
+extern bool navigationChanged; // Set by processBleEvents() on navigation updates
+extern uint32_t navIconReadyCrc; // Set by processBleEvents() once a phone icon has fully arrived
+extern bool weatherChanged;    // Set by processBleEvents() on weather updates
+
+// Function declarations
+void initDeviceState();
+void updateDeviceState(); // Once per loop() tick, before updateDisplay()
+uint32_t inputGeneration(StateInput input); // Current generation, including mid-tick queue changes
+bool weatherAvailable();  // Face registry predicates
+bool forecastAvailable();
+
+#endif // DEVICE_STATE_H
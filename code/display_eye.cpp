@@ -3,22 +3,17 @@
  */
 
  #include "display_eye.h"
+ #include "eye_raster.h"
  #include "config.h"
  
  // External objects
  extern Adafruit_SSD1306 display;
  
- // --- Tuning Constants ---
- #define EYE_RADIUS 26          // Base white ball size
- #define PUPIL_RADIUS 9         // Slightly smaller pupil for the almond shape
- #define EYELID_RADIUS 70       // Giant masking circle radius (flatter curve)
+ // Eye geometry and lid tuning live in eye_raster.h
  
-// --- Natural Shape Tuning ---
-// These control the "Resting Face" shape. 
-// 0 = Fully open (shocked). Higher = More closed (sleepy/relaxed).
-#define TOP_LID_RESTING 8      // Top lid covers 8 pixels when "open" (more natural almond)
-#define BOTTOM_LID_RESTING 5   // Bottom lid covers 5 pixels when "open"
-#define EYELID_CURVE_OFFSET 2  // Additional curve offset for more natural shape
+ // Gaze is kept in 8.8 fixed point (256 = one gaze unit)
+ #define GAZE_ONE 256
+ #define EYE_MAX_CATCHUP_STEPS 4
  
  // --- State ---
  static unsigned long lastUpdate = 0;
@@ -31,26 +26,18 @@
  static int blinkDirection = 1;
  
  // Gaze State
- static float currentX = 0;
- static float currentY = 0;
- static float targetX = 0;
- static float targetY = 0;
- 
- // Helper: Standard map function
- long map_l(long x, long in_min, long in_max, long out_min, long out_max) {
-   return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
- }
+ static int32_t currentX = 0;
+ static int32_t currentY = 0;
+ static int32_t targetX = 0;
+ static int32_t targetY = 0;
  
  void initEye() {
+   initEyeRaster();
    nextBlinkTime = millis() + 3000;
  }
  
- void displayEye() {
-   unsigned long now = millis();
-   
-   if (now - lastUpdate < 16) return;
-   lastUpdate = now;
- 
+ // Advance blink and gaze by one animation step
+ static void updateEyePhysics(unsigned long now) {
    // ===============================================
    // 1. BEHAVIOR
    // ===============================================
@@ -66,13 +53,13 @@
    // --- Look Trigger ---
    if (now > nextSaccadeTime) {
      if ((esp_random() % 100) < 75) {
-       // Small movements (Conversational)
-       targetX = ((float)(esp_random() % 100) / 40.0) - 1.25; 
-       targetY = ((float)(esp_random() % 80) / 40.0) - 1.0;
+       // Small movements (Conversational): X -1.25..1.25, Y -1.0..1.0
+       targetX = (int32_t)(esp_random() % 100) * GAZE_ONE / 40 - (GAZE_ONE * 5) / 4; 
+       targetY = (int32_t)(esp_random() % 80) * GAZE_ONE / 40 - GAZE_ONE;
      } else {
-       // Big movements (Looking away)
-       targetX = ((float)(esp_random() % 400) / 100.0) - 2.0; 
-       targetY = ((float)(esp_random() % 200) / 100.0) - 1.0;
+       // Big movements (Looking away): X -2.0..2.0, Y -1.0..1.0
+       targetX = (int32_t)(esp_random() % 400) * GAZE_ONE / 100 - 2 * GAZE_ONE; 
+       targetY = (int32_t)(esp_random() % 200) * GAZE_ONE / 100 - GAZE_ONE;
      }
      nextSaccadeTime = now + 800 + (esp_random() % 2500);
    }
@@ -101,9 +88,26 @@
     }
   }
  
-   // Smooth Gaze
-   currentX += (targetX - currentX) * 0.25;
-   currentY += (targetY - currentY) * 0.25;
+   // Smooth Gaze (ease a quarter of the way to the target each step)
+   currentX += (targetX - currentX) / 4;
+   currentY += (targetY - currentY) / 4;
+ }
+ 
+ void displayEye() {
+   unsigned long now = millis();
+   
+   // The frame scheduler decides when frames are drawn; the animation
+   // advances one step per elapsed EYE_FRAME_INTERVAL so its speed does not
+   // depend on frame timing (capped so a stale eye doesn't fast-forward)
+   int steps = 0;
+   while (now - lastUpdate >= EYE_FRAME_INTERVAL && steps < EYE_MAX_CATCHUP_STEPS) {
+     lastUpdate += EYE_FRAME_INTERVAL;
+     updateEyePhysics(now);
+     steps++;
+   }
+   if (now - lastUpdate >= EYE_FRAME_INTERVAL) {
+     lastUpdate = now;
+   }
  
    // ===============================================
    // 3. RENDERER (Almond Shape Logic)
@@ -112,62 +116,27 @@
    int cx = SCREEN_WIDTH / 2;
    int cy = SCREEN_HEIGHT / 2;
    int eyeOffset = 32; 
+   uint8_t* buffer = display.getBuffer();
  
    for(int i=0; i<2; i++) {
      int eyeCX = (i==0) ? cx - eyeOffset : cx + eyeOffset;
      int eyeCY = cy;
  
-    // A. Base Eye (White) - Perfect circle for natural eye shape
-    display.fillCircle(eyeCX, eyeCY, EYE_RADIUS, SSD1306_WHITE);
-    
-    // Optional: Add subtle inner corner highlight for more realism
-    display.fillCircle(eyeCX - EYE_RADIUS + 3, eyeCY, 2, SSD1306_WHITE);
- 
-     // B. Pupil (Black)
+     // Pupil position
      // IMPORTANT: We constrain vertical movement more tightly now
      // because the eye is "squinting" slightly in its resting state.
      int limitX = EYE_RADIUS - PUPIL_RADIUS - 2;
      int limitY = EYE_RADIUS - PUPIL_RADIUS - 6; // Stricter Y limit
      
-     int pX = eyeCX + (int)(currentX * 6.0);
-     int pY = eyeCY + (int)(currentY * 4.0);
+     int pX = eyeCX + (int)(currentX * 6 / GAZE_ONE);
+     int pY = eyeCY + (int)(currentY * 4 / GAZE_ONE);
      
      if (pX > eyeCX + limitX) pX = eyeCX + limitX;
      if (pX < eyeCX - limitX) pX = eyeCX - limitX;
      if (pY > eyeCY + limitY) pY = eyeCY + limitY;
      if (pY < eyeCY - limitY) pY = eyeCY - limitY;
  
-     display.fillCircle(pX, pY, PUPIL_RADIUS, SSD1306_BLACK);
- 
-     // C. Glint
-     display.fillCircle(pX - 3, pY - 3, 3, SSD1306_WHITE);
- 
-    // D. The Eyelids (Shaping the Eye)
-    // We calculate the Y position of the mask circles.
-    // Instead of starting "off screen", we start at the RESTING position.
-
-    // --- Upper Lid Calculation ---
-    // Open Position: Overlaps by TOP_LID_RESTING pixels for natural almond shape
-    // Refined curve positioning for more natural appearance
-    int topOpenY = (eyeCY - EYE_RADIUS) - EYELID_RADIUS + TOP_LID_RESTING + EYELID_CURVE_OFFSET;
-    // Closed Position: Reaches center for full closure with refined positioning
-    int topClosedY = eyeCY - EYELID_RADIUS + 1; // Precise closure at center
-    
-    // Smooth interpolation for eyelid movement with refined curve
-    int currentTopY = map_l(blinkPhase, 0, 100, topOpenY, topClosedY);
-    display.fillCircle(eyeCX, currentTopY, EYELID_RADIUS, SSD1306_BLACK);
-
-    // --- Lower Lid Calculation ---
-    // Open Position: Overlaps by BOTTOM_LID_RESTING pixels with refined curve
-    int botOpenY = (eyeCY + EYE_RADIUS) + EYELID_RADIUS - BOTTOM_LID_RESTING - EYELID_CURVE_OFFSET;
-    // Closed Position: Rises to meet upper lid precisely
-    int botClosedY = eyeCY + EYELID_RADIUS - 1; // Precise closure at center
-
-    // Lower lid moves less (asymmetric blink - lower lid moves ~35% of upper lid)
-    // Refined for more natural movement
-    int lowerLidPhase = (blinkPhase * 35) / 100; // Lower lid moves slower, more natural
-    int currentBotY = map_l(lowerLidPhase, 0, 100, botOpenY, botClosedY); 
-    display.fillCircle(eyeCX, currentBotY, EYELID_RADIUS, SSD1306_BLACK);
- 
+     // Eyeball, pupil, glint and eyelids composed per scanline from span tables
+     rasterizeEye(buffer, eyeCX, eyeCY, pX, pY, blinkPhase);
    }
- }
\ No newline at end of file
+ }
@@ -12,6 +12,7 @@
 extern Adafruit_SSD1306 display;
 
 // Function declarations
+void initEye();
 void displayEye();
 
 #endif // DISPLAY_EYE_H
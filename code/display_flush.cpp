@@ -0,0 +1,360 @@
+/*
+ * Display Flush - Differential transfer of the framebuffer to the SSD1306
+ *
+ * Keeps a shadow copy of what is on the panel and, per 8-row page, sends only
+ * the column ranges that changed using SSD1306 column/page addressing.
+ *
+ * A 32-bit hash of the last submitted frame is the final guard: a frame that
+ * hashes the same as what is on the panel and compares equal to the shadow
+ * returns immediately, without waiting for the transfer task or building
+ * windows. The byte compare keeps a hash collision from dropping a frame.
+ *
+ * A face that redrew only a few cells on top of its previous frame flushes
+ * through flushDisplayRegion(): only the pages and columns under its dirty
+ * rectangle are diffed and copied to the shadow, instead of hashing,
+ * diffing and copying the whole kilobyte.
+ *
+ * With DISPLAY_ASYNC_FLUSH the shadow doubles as the front buffer: faces render
+ * into the Adafruit buffer (back) while a dedicated task streams the front
+ * buffer over I2C, so loop() only blocks if a frame is ready before the
+ * previous transfer has finished.
+ */
+
+#include "display_flush.h"
+#include "power_manager.h"
+#include "latency_trace.h"
+#include "config.h"
+#include <Wire.h>
+#include <string.h>
+
+#if DISPLAY_ASYNC_FLUSH
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#endif
+
+// External objects
+extern Adafruit_SSD1306 display;
+
+#define FLUSH_PAGES (SCREEN_HEIGHT / 8)
+#define FLUSH_BUFFER_SIZE (SCREEN_WIDTH * FLUSH_PAGES)
+
+// Address window: columns c0..c1 on pages p0..p1
+struct FlushWindow {
+  uint8_t c0;
+  uint8_t c1;
+  uint8_t p0;
+  uint8_t p1;
+};
+
+// Shadow copy of the panel GDDRAM (what the last flush left on the glass)
+static uint8_t shadowBuffer[FLUSH_BUFFER_SIZE];
+static bool shadowValid = false;
+static uint32_t shadowHash = 0; // FNV-1a of shadowBuffer while shadowValid
+static bool shadowHashValid = false; // Region flushes do not rehash the frame
+static FlushWindow windows[FLUSH_MAX_WINDOWS];
+static FlushStats flushStats;
+
+#if DISPLAY_ASYNC_FLUSH
+// Transfer task state: windows[0..pendingWindows) of shadowBuffer are sent by
+// the task; flushIdle is held from submit until the transfer completes
+static TaskHandle_t flushTaskHandle = NULL;
+static SemaphoreHandle_t flushIdle = NULL;
+static volatile uint8_t pendingWindows = 0;
+#endif
+
+// FNV-1a over 32-bit words (the buffer is a whole number of words)
+static uint32_t hashFrame(const uint8_t* buffer) {
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < FLUSH_BUFFER_SIZE; i += 4) {
+    uint32_t word;
+    memcpy(&word, buffer + i, sizeof(word));
+    hash = (hash ^ word) * 16777619u;
+  }
+  return hash;
+}
+
+static uint16_t windowBytes(const FlushWindow& w) {
+  return (uint16_t)(w.c1 - w.c0 + 1) * (w.p1 - w.p0 + 1);
+}
+
+// Append a changed run, merging it into the previous page's window when the
+// extra unchanged bytes cost less than setting up a new window
+static bool addRun(uint8_t& count, uint8_t page, uint8_t c0, uint8_t c1, bool firstRunOnPage) {
+  if (count > 0 && firstRunOnPage) {
+    FlushWindow& last = windows[count - 1];
+    if (last.p1 + 1 == page) {
+      uint8_t u0 = min(last.c0, c0);
+      uint8_t u1 = max(last.c1, c1);
+      uint16_t separate = windowBytes(last) + (c1 - c0 + 1);
+      uint16_t merged = (uint16_t)(u1 - u0 + 1) * (last.p1 - last.p0 + 2);
+      if (merged <= separate + FLUSH_WINDOW_OVERHEAD) {
+        last.c0 = u0;
+        last.c1 = u1;
+        last.p1 = page;
+        return true;
+      }
+    }
+  }
+  if (count >= FLUSH_MAX_WINDOWS) {
+    return false;
+  }
+  windows[count].c0 = c0;
+  windows[count].c1 = c1;
+  windows[count].p0 = page;
+  windows[count].p1 = page;
+  count++;
+  return true;
+}
+
+// Build the list of windows that differ between buffer and the shadow copy
+// within columns c0..c1 (inclusive) of pages p0..p1
+static uint8_t collectWindows(const uint8_t* buffer, int c0, int c1, int p0, int p1) {
+  uint8_t count = 0;
+
+  if (shadowValid) {
+    int limit = c1 + 1;
+    for (uint8_t page = p0; page <= p1; page++) {
+      const uint8_t* cur = buffer + page * SCREEN_WIDTH;
+      const uint8_t* old = shadowBuffer + page * SCREEN_WIDTH;
+      if (memcmp(cur + c0, old + c0, limit - c0) == 0) {
+        continue;
+      }
+
+      bool firstRun = true;
+      int col = c0;
+      while (col < limit) {
+        // Skip unchanged columns
+        while (col < limit && cur[col] == old[col]) col++;
+        if (col >= limit) break;
+
+        // Extend the run across gaps too short to be worth a new window
+        int start = col;
+        int end = col;
+        while (col < limit) {
+          if (cur[col] != old[col]) {
+            end = col++;
+            continue;
+          }
+          int gapStart = col;
+          while (col < limit && cur[col] == old[col]) col++;
+          if (col >= limit || col - gapStart > FLUSH_WINDOW_OVERHEAD) break;
+        }
+
+        if (!addRun(count, page, start, end, firstRun)) {
+          // Too fragmented: fall back to a full-frame transfer
+          shadowValid = false;
+          break;
+        }
+        firstRun = false;
+      }
+      if (!shadowValid) break;
+    }
+  }
+
+  if (!shadowValid) {
+    windows[0].c0 = 0;
+    windows[0].c1 = SCREEN_WIDTH - 1;
+    windows[0].p0 = 0;
+    windows[0].p1 = FLUSH_PAGES - 1;
+    count = 1;
+  }
+  return count;
+}
+
+// Send one window: address setup as a single command transaction, then the
+// window's bytes in page order (horizontal addressing wraps inside the window)
+static void sendWindow(const uint8_t* buffer, const FlushWindow& w) {
+  Wire.beginTransmission(SCREEN_ADDRESS);
+  Wire.write((uint8_t)0x00); // Co = 0, D/C# = 0: command stream
+  Wire.write((uint8_t)SSD1306_COLUMNADDR);
+  Wire.write(w.c0);
+  Wire.write(w.c1);
+  Wire.write((uint8_t)SSD1306_PAGEADDR);
+  Wire.write(w.p0);
+  Wire.write(w.p1);
+  Wire.endTransmission();
+
+  Wire.beginTransmission(SCREEN_ADDRESS);
+  Wire.write((uint8_t)0x40); // D/C# = 1: data stream
+  int bytesOut = 1;
+  for (uint8_t page = w.p0; page <= w.p1; page++) {
+    const uint8_t* row = buffer + page * SCREEN_WIDTH;
+    for (int col = w.c0; col <= w.c1; col++) {
+      if (bytesOut >= DISPLAY_I2C_CHUNK) {
+        Wire.endTransmission();
+        Wire.beginTransmission(SCREEN_ADDRESS);
+        Wire.write((uint8_t)0x40);
+        bytesOut = 1;
+      }
+      Wire.write(row[col]);
+      bytesOut++;
+    }
+  }
+  Wire.endTransmission();
+}
+
+#if DISPLAY_ASYNC_FLUSH
+static void flushTask(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    uint8_t count = pendingWindows;
+    beginFlushBoost();
+    for (uint8_t i = 0; i < count; i++) {
+      sendWindow(shadowBuffer, windows[i]);
+    }
+    endFlushBoost();
+    traceFlushComplete();
+    xSemaphoreGive(flushIdle);
+  }
+}
+#endif
+
+void initDisplayFlush() {
+  shadowValid = false;
+  memset(&flushStats, 0, sizeof(flushStats));
+
+#if DISPLAY_ASYNC_FLUSH
+  if (flushTaskHandle == NULL) {
+    flushIdle = xSemaphoreCreateBinary();
+    xSemaphoreGive(flushIdle);
+    xTaskCreate(flushTask, "oled_flush", DISPLAY_FLUSH_TASK_STACK, NULL,
+                DISPLAY_FLUSH_TASK_PRIORITY, &flushTaskHandle);
+  }
+#endif
+}
+
+void waitDisplayFlush() {
+#if DISPLAY_ASYNC_FLUSH
+  if (flushIdle == NULL) return;
+  xSemaphoreTake(flushIdle, portMAX_DELAY);
+  xSemaphoreGive(flushIdle);
+#endif
+}
+
+void invalidateDisplayFlush() {
+  shadowValid = false;
+}
+
+// Hand the collected windows to the panel and account for them
+static void submitWindows(uint8_t count) {
+  uint16_t sent = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    sent += windowBytes(windows[i]);
+  }
+  if (count == 0) {
+    flushStats.unchangedFrames++;
+  }
+  traceFlushSubmitted();
+
+#if DISPLAY_ASYNC_FLUSH
+  if (count > 0) {
+    pendingWindows = count;
+    xTaskNotifyGive(flushTaskHandle);
+  } else {
+    // Nothing to send: the panel already shows this frame
+    traceFlushComplete();
+    xSemaphoreGive(flushIdle);
+  }
+#else
+  for (uint8_t i = 0; i < count; i++) {
+    sendWindow(shadowBuffer, windows[i]);
+  }
+  traceFlushComplete();
+#endif
+
+  uint16_t saved = (sent < FLUSH_BUFFER_SIZE) ? FLUSH_BUFFER_SIZE - sent : 0;
+  flushStats.frames++;
+  flushStats.lastBytesSent = sent;
+  flushStats.lastBytesSaved = saved;
+  flushStats.lastWindows = count;
+  flushStats.totalBytesSent += sent;
+  flushStats.totalBytesSaved += saved;
+}
+
+static void waitFlushIdle() {
+#if DISPLAY_ASYNC_FLUSH
+  // The shadow and window list belong to the transfer task until it is idle
+  if (xSemaphoreTake(flushIdle, 0) != pdTRUE) {
+    flushStats.busyWaits++;
+    xSemaphoreTake(flushIdle, portMAX_DELAY);
+  }
+#endif
+}
+
+void flushDisplay() {
+  const uint8_t* buffer = display.getBuffer();
+  uint32_t hash = hashFrame(buffer);
+  // The hash rejects most changed frames cheaply; a match is confirmed byte
+  // for byte (the transfer task only reads the shadow, so no wait is needed)
+  if (shadowValid && shadowHashValid && hash == shadowHash &&
+      memcmp(buffer, shadowBuffer, FLUSH_BUFFER_SIZE) == 0) {
+    flushStats.frames++;
+    flushStats.hashSkips++;
+    flushStats.lastBytesSent = 0;
+    flushStats.lastBytesSaved = FLUSH_BUFFER_SIZE;
+    flushStats.lastWindows = 0;
+    flushStats.totalBytesSaved += FLUSH_BUFFER_SIZE;
+    // The panel already shows this frame, or will once the running transfer
+    // (which then completes the trace) finishes
+    traceFlushSubmitted();
+#if DISPLAY_ASYNC_FLUSH
+    if (xSemaphoreTake(flushIdle, 0) == pdTRUE) {
+      traceFlushComplete();
+      xSemaphoreGive(flushIdle);
+    }
+#else
+    traceFlushComplete();
+#endif
+    return;
+  }
+
+  waitFlushIdle();
+  uint8_t count = collectWindows(buffer, 0, SCREEN_WIDTH - 1, 0, FLUSH_PAGES - 1);
+  if (count > 0) {
+    // Snapshot the back buffer; it is free for the next frame from here on
+    memcpy(shadowBuffer, buffer, FLUSH_BUFFER_SIZE);
+  }
+  shadowValid = true;
+  shadowHash = hash;
+  shadowHashValid = true;
+  submitWindows(count);
+}
+
+void flushDisplayRegion(const DisplayRegion& region) {
+  if (!shadowValid) {
+    flushDisplay(); // Nothing to diff against yet
+    return;
+  }
+
+  // Clip to whole pages and columns
+  int c0 = max((int)region.x, 0);
+  int c1 = min(region.x + region.w, SCREEN_WIDTH) - 1;
+  int p0 = max((int)region.y, 0) >> 3;
+  int p1 = (min(region.y + region.h, SCREEN_HEIGHT) - 1) >> 3;
+
+  const uint8_t* buffer = display.getBuffer();
+  waitFlushIdle();
+  flushStats.regionFlushes++;
+  uint8_t count = 0;
+  if (c0 <= c1 && p0 <= p1) {
+    count = collectWindows(buffer, c0, c1, p0, p1);
+  }
+  if (!shadowValid) {
+    // Too fragmented: collectWindows() fell back to a full frame
+    memcpy(shadowBuffer, buffer, FLUSH_BUFFER_SIZE);
+    shadowValid = true;
+  } else if (count > 0) {
+    for (int page = p0; page <= p1; page++) {
+      memcpy(shadowBuffer + page * SCREEN_WIDTH + c0, buffer + page * SCREEN_WIDTH + c0, c1 - c0 + 1);
+    }
+  }
+  if (count > 0) {
+    shadowHashValid = false; // Rehashed by the next full flush
+  }
+  submitWindows(count);
+}
+
+const FlushStats& getFlushStats() {
+  return flushStats;
+}
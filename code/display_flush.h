@@ -0,0 +1,47 @@
+/*
+ * Display Flush - Differential transfer of the framebuffer to the SSD1306
+ */
+
+#ifndef DISPLAY_FLUSH_H
+#define DISPLAY_FLUSH_H
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+
+// Forward declarations
+extern Adafruit_SSD1306 display;
+
+// Flush statistics (bytes are GDDRAM data bytes, excluding I2C framing)
+struct FlushStats {
+  unsigned long frames;          // Flushes requested
+  unsigned long unchangedFrames; // Flushes where nothing differed from the panel
+  unsigned long hashSkips;       // Flushes dropped up front: frame hash matched the panel's
+  unsigned long busyWaits;       // Flushes that had to wait for the previous transfer
+  unsigned long regionFlushes;   // Flushes limited to a face's dirty region
+  uint16_t lastBytesSent;        // Data bytes sent by the last flush
+  uint16_t lastBytesSaved;       // Data bytes the last flush avoided vs a full frame
+  uint8_t lastWindows;           // Address windows used by the last flush
+  unsigned long totalBytesSent;
+  unsigned long totalBytesSaved;
+};
+
+// Pixel rectangle of the framebuffer; empty when w or h is 0
+struct DisplayRegion {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+// Function declarations
+void initDisplayFlush();
+void flushDisplay();
+// Like flushDisplay(), but only the pages and columns covering region are
+// diffed and copied; the caller guarantees nothing outside it changed since
+// the last flush
+void flushDisplayRegion(const DisplayRegion& region);
+void invalidateDisplayFlush();
+void waitDisplayFlush(); // Call before any other I2C access to the panel
+const FlushStats& getFlushStats();
+
+#endif // DISPLAY_FLUSH_H
@@ -4,38 +4,33 @@
 
 #include "display_forecast.h"
 #include "display_weather.h"
+#include "device_state.h"
+#include "framebuffer.h"
+#include "text_layout.h"
 #include "config.h"
 #include <string.h>
 
 // External objects
 extern Adafruit_SSD1306 display;
-extern ChronosESP32 chronos;
 
 void displayForecast() {
-  int forecastCount = chronos.getWeatherCount();
+  // Days after today, copied when the phone last sent weather
+  const WeatherState& state = deviceState.weather;
   
-  // Need at least 2 entries for forecast (current + at least 1 future)
-  if (forecastCount < 2) {
-    display.setCursor(0, 20);
-    display.setTextSize(1);
-    display.println("No forecast");
-    display.println("data available");
-    display.setCursor(0, 40);
-    display.println("Check Chronos");
-    display.println("app settings");
+  // Need at least 1 future day
+  if (state.forecastCount < 1) {
+    drawText("No forecast", 0, 20);
+    drawText("data available", 0, 28);
+    drawText("Check Chronos", 0, 40);
+    drawText("app settings", 0, 48);
     return;
   }
   
   // Top header: "Forecast" title
-  display.fillRect(0, 0, SCREEN_WIDTH, 9, SSD1306_WHITE);
-  display.setTextColor(SSD1306_BLACK);
-  display.setTextSize(1);
+  fbFillRect(display.getBuffer(), 0, 0, SCREEN_WIDTH, 9, SSD1306_WHITE);
   const char* title = "Forecast";
-  int titleWidth = strlen(title) * 6;
-  int titleX = (SCREEN_WIDTH - titleWidth) / 2;
-  display.setCursor(titleX, 1);
-  display.print(title);
-  display.setTextColor(SSD1306_WHITE);
+  int titleX = (SCREEN_WIDTH - fontTextWidth(fontSmall, title)) / 2;
+  drawText(title, titleX, 1, fontSmall, SSD1306_BLACK);
   
   // Display up to 4 forecast entries (skip index 0 which is current weather)
   // Layout: 2 rows x 2 columns of forecast items
@@ -49,11 +44,10 @@ void displayForecast() {
   //   - Top row: Y 9-35 (27px)
   //   - Bottom row: Y 36-62 (27px)
   // Each item contains:
-  //   - Icon: 20x20px at (startX+2, startY+2), but some icons draw beyond bounds
-  //   - Icon area reserved: 38px from left edge (covers worst case overflow to x+35)
-  //   - Text area: starts at X=startX+38, ~26px wide (sufficient for all text)
+  //   - Icon: 20x20px pre-rasterized bitmap at (startX+2, startY+2), always inside its box
+  //   - Text area: starts at X=startX+24 (icon + 2px gap), 40px wide
   //   - Text lines: Temp at Y=textY, H: at Y=textY+8, L: at Y=textY+16
-  int maxForecastItems = min(4, forecastCount - 1); // Skip current (index 0)
+  int maxForecastItems = state.forecastCount; // At most WEATHER_FORECAST_MAX (4)
   int itemWidth = SCREEN_WIDTH / 2; // 64px per item
   int headerHeight = 9; // Header occupies Y 0-8
   int availableHeight = SCREEN_HEIGHT - headerHeight; // 55px available (Y 9-63)
@@ -61,8 +55,7 @@ void displayForecast() {
   int iconSize = 20; // Small icons for forecast
   
   for (int i = 0; i < maxForecastItems; i++) {
-    int forecastIndex = i + 1; // Skip index 0 (current weather)
-    Weather forecast = chronos.getWeatherAt(forecastIndex);
+    const Weather& forecast = state.forecast[i];
     
     // Calculate position: row and column
     int row = i / 2;
@@ -74,11 +67,11 @@ void displayForecast() {
     // Draw divider lines between items
     if (col == 1) {
       // Vertical divider between columns (at X=64, from header to bottom)
-      display.drawLine(startX, headerHeight, startX, SCREEN_HEIGHT - 1, SSD1306_WHITE);
+      fbVLine(display.getBuffer(), startX, headerHeight, SCREEN_HEIGHT - headerHeight, SSD1306_WHITE);
     }
     if (row == 1) {
       // Horizontal divider between rows (at Y=36, full width)
-      display.drawLine(0, startY, SCREEN_WIDTH - 1, startY, SSD1306_WHITE);
+      fbHLine(display.getBuffer(), 0, startY, SCREEN_WIDTH, SSD1306_WHITE);
     }
     
     // Draw small icon (20x20) at top-left of item with padding
@@ -87,43 +80,29 @@ void displayForecast() {
     int iconX = startX + padding;
     int iconY = startY + padding;
     
-    // Use the existing drawWeatherIcon function with 20x20 size
-    // WARNING: Some icons (3-8) use hardcoded coordinates for 36px icons
-    // These will draw beyond the 20px bounds (up to x+26, x+33, etc.)
-    // We must reserve enough space to prevent text overlap
+    // Atlas icons are drawn exactly within their 20x20 box
     drawWeatherIcon(forecast.icon, iconX, iconY, iconSize);
     
     // Temperature and text on the right side of item
-    // CRITICAL: Some icons (3-8) use hardcoded coordinates for 36px icons
-    // Worst case: fog icon (7) draws lines to x+33 from icon start
-    // Icon starts at startX + 2, worst case draws to startX + 2 + 33 = startX + 35
-    // Reserve 38px from left edge (covers x+35 + 3px safety margin)
-    int iconAreaReserved = 38; // Reserve 38px for icon area (safe margin after worst case)
-    int textStartX = startX + iconAreaReserved; // Start text at startX + 38
-    
-    // Verify text fits within item bounds (each item is 64px wide)
-    // Available text width: itemWidth - iconAreaReserved = 64 - 38 = 26px
-    // This is enough for: "XXC" (~18px), "H:XX" (~24px), "L:XX" (~24px)
-    // For left column: textStartX = 0 + 38 = 38, available = 26px
-    // For right column: textStartX = 64 + 38 = 102, available = 26px
+    // Text starts 2px after the icon: startX + 2 + 20 + 2 = startX + 24
+    // Available text width: itemWidth - 24 = 40px, enough for "H:-XX" and "-XXC"
+    int iconAreaReserved = padding + iconSize + 2;
+    int textStartX = startX + iconAreaReserved;
     
     // Text Y position: align with icon top
     int textY = startY + padding; // Same Y as icon top (startY + 2)
     
     // Temperature (top)
-    display.setCursor(textStartX, textY);
-    display.setTextSize(1);
-    display.print(forecast.temp);
-    display.print("C");
+    char text[16];
+    int length = snprintf(text, sizeof(text), "%dC", forecast.temp);
+    drawText(text, length, textStartX, textY);
     
     // High/Low below temp (compact, 8px line spacing)
-    int lineHeight = 8; // Standard line height for size 1 text
-    display.setCursor(textStartX, textY + lineHeight);
-    display.print("H:");
-    display.print(forecast.high);
-    display.setCursor(textStartX, textY + (lineHeight * 2));
-    display.print("L:");
-    display.print(forecast.low);
+    int lineHeight = fontSmall.height;
+    length = snprintf(text, sizeof(text), "H:%d", forecast.high);
+    drawText(text, length, textStartX, textY + lineHeight);
+    length = snprintf(text, sizeof(text), "L:%d", forecast.low);
+    drawText(text, length, textStartX, textY + (lineHeight * 2));
   }
 }
 
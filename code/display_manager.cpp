@@ -3,14 +3,16 @@
  */
 
 #include "display_manager.h"
-#include "display_time.h"
-#include "display_weather.h"
-#include "display_forecast.h"
-#include "display_notification.h"
-#include "display_navigation.h"
+#include "face_registry.h"
 #include "display_eye.h"
+#include "nav_classifier.h"
+#include "nav_icon_cache.h"
+#include "display_flush.h"
+#include "frame_scheduler.h"
+#include "power_manager.h"
+#include "profiler.h"
 #include "notification_queue.h"
-#include "weather_cache.h"
+#include "device_state.h"
 #include "config.h"
 
 // External variables
@@ -24,69 +26,13 @@ DisplayMode previousMode = MODE_TIME;
 unsigned long lastModeSwitch = 0;
 unsigned long lastDisplayUpdate = 0;
 bool displayNeedsUpdate = true;
+static bool hasRenderedFrame = false; // Nothing of ours on the panel yet
 
 // External notification queue variables
 extern int notificationQueueCount;
 extern int currentNotificationIndex;
 extern unsigned long notificationStartTime;
 
-// Helper function to get the first enabled face (default fallback)
-static DisplayMode getFirstEnabledFace() {
-  if (ENABLE_TIME_FACE) return MODE_TIME;
-  if (ENABLE_WEATHER_FACE) return MODE_WEATHER;
-  if (ENABLE_FORECAST_FACE) return MODE_FORECAST;
-  if (ENABLE_EYE_FACE) return MODE_EYE;
-  // If all are disabled, default to time (shouldn't happen in normal use)
-  return MODE_TIME;
-}
-
-// Helper function to get next enabled face in the cycle
-static DisplayMode getNextEnabledFace(DisplayMode current) {
-  // Cycle: TIME -> WEATHER -> FORECAST -> EYE -> TIME
-  if (current == MODE_TIME) {
-    if (ENABLE_WEATHER_FACE && hasWeatherData()) {
-      return MODE_WEATHER;
-    } else if (ENABLE_FORECAST_FACE && chronos.getWeatherCount() >= 2) {
-      return MODE_FORECAST;
-    } else if (ENABLE_EYE_FACE) {
-      return MODE_EYE;
-    } else {
-      return MODE_TIME; // Stay on time if others disabled or no data
-    }
-  } else if (current == MODE_WEATHER) {
-    if (ENABLE_FORECAST_FACE && chronos.getWeatherCount() >= 2) {
-      return MODE_FORECAST;
-    } else if (ENABLE_EYE_FACE) {
-      return MODE_EYE;
-    } else if (ENABLE_TIME_FACE) {
-      return MODE_TIME;
-    } else {
-      return MODE_WEATHER; // Stay on weather if others disabled
-    }
-  } else if (current == MODE_FORECAST) {
-    if (ENABLE_EYE_FACE) {
-      return MODE_EYE;
-    } else if (ENABLE_TIME_FACE) {
-      return MODE_TIME;
-    } else if (ENABLE_WEATHER_FACE && hasWeatherData()) {
-      return MODE_WEATHER;
-    } else {
-      return MODE_FORECAST; // Stay on forecast if others disabled
-    }
-  } else if (current == MODE_EYE) {
-    if (ENABLE_TIME_FACE) {
-      return MODE_TIME;
-    } else if (ENABLE_WEATHER_FACE && hasWeatherData()) {
-      return MODE_WEATHER;
-    } else if (ENABLE_FORECAST_FACE && chronos.getWeatherCount() >= 2) {
-      return MODE_FORECAST;
-    } else {
-      return MODE_EYE; // Stay on eye if others disabled
-    }
-  }
-  return getFirstEnabledFace();
-}
-
 void initDisplayManager() {
   // Initialize to first enabled face
   currentMode = getFirstEnabledFace();
@@ -94,23 +40,45 @@ void initDisplayManager() {
   lastModeSwitch = 0;
   lastDisplayUpdate = 0;
   displayNeedsUpdate = true;
+  hasRenderedFrame = false;
+  initFrameScheduler();
+  if (getFace(MODE_EYE).enabled) {
+    initEye();
+  }
+  if (getFace(MODE_NAVIGATION).enabled) {
+    initNavClassifier();
+    initNavIconCache();
+  }
+}
+
+// Time until the manager next has work: a frame deadline, a face rotation
+// or a notification expiring. Capped at LOOP_MAX_SLEEP by msUntilNextFrame().
+unsigned long msUntilNextUpdate(unsigned long now) {
+  unsigned long wait = msUntilNextFrame(now);
+
+  unsigned long modeDuration = getFace(currentMode).duration;
+  if (modeDuration > 0) {
+    unsigned long elapsed = now - lastModeSwitch;
+    wait = min(wait, elapsed >= modeDuration ? 0UL : modeDuration - elapsed);
+  }
+
+  if (notificationQueueCount > 0) {
+    unsigned long timeout = deviceState.nav.active ? NOTIFICATION_DISPLAY_TIME_NAV : NOTIFICATION_DISPLAY_TIME;
+    unsigned long elapsed = now - notificationStartTime;
+    wait = min(wait, elapsed >= timeout ? 0UL : timeout - elapsed);
+  }
+  return wait;
 }
 
 void updateDisplay() {
   unsigned long currentTime = millis();
   bool modeChanged = false;
-  // Cache navigation state to avoid multiple calls
-  static Navigation cachedNav;
-  static unsigned long lastNavCheck = 0;
-  // Update navigation cache every 100ms (navigation updates frequently)
-  if (currentTime - lastNavCheck >= 100) {
-    cachedNav = chronos.getNavigation();
-    lastNavCheck = currentTime;
-  }
-  Navigation nav = cachedNav;
+  PROFILE_BEGIN(modeStart);
+  // Navigation and link state come from this tick's snapshot
+  const NavState& nav = deviceState.nav;
 
   // Priority 1: Notifications (highest priority, interrupts everything)
-  if (ENABLE_NOTIFICATION_FACE && hasActiveNotification(currentTime, nav.active)) {
+  if (getFace(MODE_NOTIFICATION).enabled && hasActiveNotification(currentTime, nav.active)) {
     if (currentMode != MODE_NOTIFICATION) {
       currentMode = MODE_NOTIFICATION;
       modeChanged = true;
@@ -118,7 +86,7 @@ void updateDisplay() {
     }
   } 
   // Priority 2: Navigation (overrides time/weather loop immediately)
-  else if (ENABLE_NAVIGATION_FACE && chronos.isConnected() && nav.active) {
+  else if (getFace(MODE_NAVIGATION).enabled && deviceState.link.connected && nav.active) {
     if (currentMode != MODE_NAVIGATION) {
       currentMode = MODE_NAVIGATION;
       modeChanged = true;
@@ -137,17 +105,8 @@ void updateDisplay() {
     }
     // Switch between enabled faces with different durations
     // Cycle: TIME (20s) -> WEATHER (10s) -> FORECAST (10s) -> EYE (15s) -> TIME
-    unsigned long modeDuration = 0;
-    if (currentMode == MODE_TIME) {
-      modeDuration = MODE_TIME_DURATION;
-    } else if (currentMode == MODE_WEATHER) {
-      modeDuration = MODE_WEATHER_DURATION;
-    } else if (currentMode == MODE_FORECAST) {
-      modeDuration = MODE_FORECAST_DURATION;
-    } else if (currentMode == MODE_EYE) {
-      modeDuration = MODE_EYE_DURATION;
-    }
-    
+    unsigned long modeDuration = getFace(currentMode).duration;
+
     if (modeDuration > 0 && (currentTime - lastModeSwitch) >= modeDuration) {
       DisplayMode nextMode = getNextEnabledFace(currentMode);
       if (nextMode != currentMode) {
@@ -162,7 +121,7 @@ void updateDisplay() {
     }
     
     // Process notification queue (handles timeout and cleanup)
-    if (ENABLE_NOTIFICATION_FACE) {
+    if (getFace(MODE_NOTIFICATION).enabled) {
       processNotificationQueue(currentTime, nav.active);
     }
     
@@ -175,92 +134,70 @@ void updateDisplay() {
   }
 
   // Safety check: if current mode is disabled, switch to first enabled face
-  bool currentModeEnabled = false;
-  switch (currentMode) {
-    case MODE_TIME:
-      currentModeEnabled = ENABLE_TIME_FACE;
-      break;
-    case MODE_WEATHER:
-      currentModeEnabled = ENABLE_WEATHER_FACE;
-      break;
-    case MODE_FORECAST:
-      currentModeEnabled = ENABLE_FORECAST_FACE;
-      break;
-    case MODE_NOTIFICATION:
-      currentModeEnabled = ENABLE_NOTIFICATION_FACE;
-      break;
-    case MODE_NAVIGATION:
-      currentModeEnabled = ENABLE_NAVIGATION_FACE;
-      break;
-    case MODE_EYE:
-      currentModeEnabled = ENABLE_EYE_FACE;
-      break;
-  }
-  
-  if (!currentModeEnabled) {
+  if (!getFace(currentMode).enabled) {
     currentMode = getFirstEnabledFace();
     modeChanged = true;
     displayNeedsUpdate = true;
   }
 
-  // Only update display if mode changed or content needs refresh
-  // For time mode, update every second for seconds counter
-  // For navigation mode, update frequently for smooth real-time updates
-  // For eye mode, update frequently for smooth animation (every 100ms)
-  // For other modes, update when mode changes or every 500ms
-  bool shouldUpdate = displayNeedsUpdate || modeChanged || 
-                      (currentMode == MODE_TIME && (currentTime - lastDisplayUpdate >= 1000)) ||
-                      (currentMode == MODE_NAVIGATION && (currentTime - lastDisplayUpdate >= 500)) ||
-                      (currentMode == MODE_EYE && (currentTime - lastDisplayUpdate >= 100)) ||
-                      (currentMode != MODE_TIME && currentMode != MODE_NAVIGATION && currentMode != MODE_EYE && currentMode != previousMode);
+  // Redraw when the mode changed, or when something may have changed (an
+  // event or the face's frame deadline, see FRAME_INTERVAL_* in config.h)
+  // and one of the inputs the face declares actually moved since the last
+  // frame (see inputs in face_registry.h). Otherwise skip render and flush.
+  bool frameDue = isFrameDue(currentMode, currentTime);
+  bool shouldUpdate = modeChanged || !hasRenderedFrame ||
+                      ((displayNeedsUpdate || frameDue) && faceNeedsRender(getFace(currentMode)));
+  if (!shouldUpdate) {
+    if (frameDue) {
+      skipFrame(currentMode, currentTime);
+    }
+    displayNeedsUpdate = false;
+  }
+  PROFILE_END(modeStart, PROFILE_MODE_LOGIC);
   
   if (shouldUpdate) {
     // Smooth transition: brief dim effect when mode changes
     if (modeChanged && previousMode != MODE_TIME) {
       // Very brief dim for smooth transition (only for non-time modes)
+      // Contrast commands share the bus with the frame transfer task
+      waitDisplayFlush();
       display.dim(true);
       delay(5); // Minimal delay for smooth transition
       display.dim(false);
     }
     
-    display.clearDisplay();
-    display.setTextSize(1);
-    display.setTextColor(SSD1306_WHITE);
+    // Render + flush time is measured against the face's budget, with the
+    // CPU boosted for the whole burst
+    beginCpuBoost();
+    beginFrame(currentMode, currentTime);
 
-    switch (currentMode) {
-      case MODE_TIME:
-        if (ENABLE_TIME_FACE) {
-          displayTime();
-        }
-        break;
-      case MODE_WEATHER:
-        if (ENABLE_WEATHER_FACE) {
-          displayWeather();
-        }
-        break;
-      case MODE_FORECAST:
-        if (ENABLE_FORECAST_FACE) {
-          displayForecast();
-        }
-        break;
-      case MODE_NOTIFICATION:
-        if (ENABLE_NOTIFICATION_FACE) {
-          displayNotification();
-        }
-        break;
-      case MODE_NAVIGATION:
-        if (ENABLE_NAVIGATION_FACE) {
-          displayNavigation();
-        }
-        break;
-      case MODE_EYE:
-        if (ENABLE_EYE_FACE) {
-          displayEye();
-        }
-        break;
+    PROFILE_BEGIN(renderStart);
+    // While a face stays on screen its last frame is still in the buffer, so
+    // one with an update hook may redraw just the cells that changed
+    const FaceDescriptor& face = getFace(currentMode);
+    DisplayRegion dirty = {0, 0, 0, 0};
+    bool regionUpdate = !modeChanged && hasRenderedFrame && previousMode == currentMode &&
+                        face.update != nullptr && face.update(dirty);
+    if (!regionUpdate) {
+      display.clearDisplay();
+      if (face.render != nullptr) {
+        face.render();
+      }
     }
+    PROFILE_END(renderStart, PROFILE_RENDER_TIME + currentMode);
 
-    display.display();
+    // Send only the pages/columns that changed since the last frame
+    PROFILE_BEGIN(flushStart);
+    if (regionUpdate) {
+      flushDisplayRegion(dirty);
+    } else {
+      flushDisplay();
+    }
+    PROFILE_END(flushStart, PROFILE_FLUSH);
+    endFrame();
+    endCpuBoost();
+    markFaceRendered();
+    hasRenderedFrame = true;
     previousMode = currentMode;
     lastDisplayUpdate = currentTime;
     displayNeedsUpdate = false;
@@ -35,6 +35,7 @@ extern bool displayNeedsUpdate;
 // Function declarations
 void initDisplayManager();
 void updateDisplay();
+unsigned long msUntilNextUpdate(unsigned long now);
 
 #endif // DISPLAY_MANAGER_H
 
@@ -16,7 +16,7 @@ extern ESP32Time rtc;
 
 // Function declarations
 void displayNavigation();
-void drawNavigationArrow(String direction, int x, int y);
+void drawNavigationIcon(const char* direction, int x, int y);
 
 #endif // DISPLAY_NAVIGATION_H
 
@@ -1,100 +1,153 @@
 /*
  * Display Time - Time display functions
+ *
+ * The face is drawn in full when it comes on screen. After that, a new
+ * second normally changes one or two digits. updateTime() compares the new
+ * hh:mm:ss with what is already in the framebuffer and clears and reblits
+ * only the glyph cells that differ. The manager then flushes just that
+ * rectangle. The battery line, the day name and the date are left alone
+ * until they change (the date at midnight), and then the face is redrawn
+ * in full.
  */
 
 #include "display_time.h"
+#include "device_state.h"
+#include "framebuffer.h"
+#include "text_layout.h"
 #include "config.h"
 #include <string.h>
 
 // External objects
 extern Adafruit_SSD1306 display;
-extern ChronosESP32 chronos;
-extern ESP32Time rtc;
+
+#define TIME_TEXT_Y 18
+#define DATE_TEXT_Y 38
+#define TIME_TEXT_MAX 12
+#define DATE_TEXT_MAX 24
+
+// What the framebuffer currently shows, for updateTime()
+static char drawnTime[TIME_TEXT_MAX];
+static int16_t timeCellX[TIME_TEXT_MAX]; // Left edge of each glyph cell
+static char drawnDate[DATE_TEXT_MAX];
+static int drawnBatteryWidth = 0;
+static bool drawnConnected = false;
+static bool timeDrawn = false;
+
+// Width of the top battery line, 0 = none
+static int batteryLineWidth(bool isConnected, int batteryLevel) {
+  if (!isConnected || batteryLevel <= 0) {
+    return 0;
+  }
+  return (batteryLevel * SCREEN_WIDTH) / 100;
+}
+
+static int formatTime(char* buf, size_t size, const ClockState& clock) {
+  return snprintf(buf, size, "%02d:%02d:%02d", clock.hour, clock.minute, clock.second);
+}
+
+static int formatDate(char* buf, size_t size, const ClockState& clock) {
+  // Day name - full day name (no padding)
+  static const char* const dayNames[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+  return snprintf(buf, size, "%s %02d/%02d/%d", dayNames[clock.dayOfWeek], clock.day, clock.month, clock.year);
+}
 
 void displayTime() {
   // Modern watch face design
   
   // Top decorative line - Phone battery indicator (full line = full battery)
-  // Cache connection state (checked in display_manager, but we need it here too)
-  static bool cachedConnected = false;
-  static unsigned long lastConnCheck = 0;
-  unsigned long now = millis();
-  // Update connection cache every 500ms
-  if (now - lastConnCheck >= 500) {
-    cachedConnected = chronos.isConnected();
-    lastConnCheck = now;
-  }
-  bool isConnected = cachedConnected;
-  
-  int batteryLevel = 0;
-  if (isConnected) {
-    // Get phone battery level from ChronosESP32
-    batteryLevel = chronos.getPhoneBattery();
-    // Ensure battery level is in valid range (0-100)
-    if (batteryLevel < 0) batteryLevel = 0;
-    if (batteryLevel > 100) batteryLevel = 100;
-  }
+  // Connection and battery (already clamped to 0-100) from this tick's snapshot
+  const ClockState& clock = deviceState.clock;
+  bool isConnected = deviceState.link.connected;
+  int batteryWidth = batteryLineWidth(isConnected, deviceState.link.phoneBattery);
   
   // Draw battery indicator line (top line, proportional to battery level)
   // Full line (128px) = 100% battery
-  if (isConnected && batteryLevel > 0) {
-    int batteryWidth = (batteryLevel * SCREEN_WIDTH) / 100;
-    if (batteryWidth > 0) {
-      display.drawLine(0, 0, batteryWidth - 1, 0, SSD1306_WHITE);
-    }
+  if (batteryWidth > 0) {
+    fbHLine(display.getBuffer(), 0, 0, batteryWidth, SSD1306_WHITE);
   }
   
-  // Large time display - hh:mm:ss all in one line, centered
-  int hour = chronos.getHourC();
-  int minute = rtc.getMinute();
-  int second = rtc.getSecond();
+  // Large time display - hh:mm:ss all in one line, centered on the exact
+  // width in the large font
+  char timeBuf[TIME_TEXT_MAX];
+  int timeLen = formatTime(timeBuf, sizeof(timeBuf), clock);
+  if (timeLen >= TIME_TEXT_MAX) timeLen = TIME_TEXT_MAX - 1;
+  int timeX = (SCREEN_WIDTH - fontTextWidth(fontLarge, timeBuf, timeLen)) / 2;
+  drawText(timeBuf, timeLen, timeX, TIME_TEXT_Y, fontLarge);
   
-  // Calculate width directly: 8 chars (hh:mm:ss) = 96px at size 2
-  display.setTextSize(2);
-  int timeX = (SCREEN_WIDTH - 96) / 2; // Fixed width for hh:mm:ss
-  display.setCursor(timeX, 18);
-  // Print directly without String concatenation
-  if (hour < 10) display.print("0");
-  display.print(hour);
-  display.print(":");
-  if (minute < 10) display.print("0");
-  display.print(minute);
-  display.print(":");
-  if (second < 10) display.print("0");
-  display.print(second);
-  
-  // Date display - centered below time
-  int day = rtc.getDay();
-  int month = rtc.getMonth() + 1; // ESP32Time returns 0-11, convert to 1-12 for display
-  int year = rtc.getYear();
-  
-  // Day name - full day name (no padding)
-  const char* dayNames[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
-  int dayOfWeek = rtc.getDayofWeek();
-  
-  // Calculate date width: dayName (varies) + space + DD/MM/YYYY (10 chars) = ~6-13 chars for dayName + 10
-  // Longest day name is "Wednesday" = 9 chars, so max = 9 + 1 + 10 = 20 chars = 120px
-  // We'll calculate dynamically but use direct printing
-  display.setTextSize(1);
-  const char* dayName = dayNames[dayOfWeek];
-  int dayNameLen = strlen(dayName);
-  int dateWidth = (dayNameLen + 1 + 10) * 6; // dayName + space + DD/MM/YYYY
-  int dateX = (SCREEN_WIDTH - dateWidth) / 2;
-  display.setCursor(dateX, 38);
-  // Print directly without String concatenation
-  display.print(dayName);
-  display.print(" ");
-  if (day < 10) display.print("0");
-  display.print(day);
-  display.print("/");
-  if (month < 10) display.print("0");
-  display.print(month);
-  display.print("/");
-  display.print(year);
+  // Date display - centered below time, measured in the proportional font so
+  // every day name centers exactly
+  char dateBuf[DATE_TEXT_MAX];
+  int dateLen = formatDate(dateBuf, sizeof(dateBuf), clock);
+  if (dateLen >= DATE_TEXT_MAX) dateLen = DATE_TEXT_MAX - 1;
+  int dateX = (SCREEN_WIDTH - fontTextWidth(fontSmall, dateBuf, dateLen)) / 2;
+  drawText(dateBuf, dateLen, dateX, DATE_TEXT_Y);
   
   // Bottom decorative line - Only show when connected
   if (isConnected) {
-    display.drawLine(0, SCREEN_HEIGHT - 1, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, SSD1306_WHITE);
+    fbHLine(display.getBuffer(), 0, SCREEN_HEIGHT - 1, SCREEN_WIDTH, SSD1306_WHITE);
+  }
+
+  // Remember the glyph cells for updateTime()
+  memcpy(drawnTime, timeBuf, timeLen);
+  drawnTime[timeLen] = '\0';
+  int cellX = timeX;
+  for (int i = 0; i < timeLen; i++) {
+    timeCellX[i] = cellX;
+    cellX += fontCharWidth(fontLarge, timeBuf[i]) + fontLarge.spacing;
   }
+  memcpy(drawnDate, dateBuf, dateLen);
+  drawnDate[dateLen] = '\0';
+  drawnBatteryWidth = batteryWidth;
+  drawnConnected = isConnected;
+  timeDrawn = true;
 }
 
+bool updateTime(DisplayRegion& dirty) {
+  const ClockState& clock = deviceState.clock;
+  bool isConnected = deviceState.link.connected;
+  if (!timeDrawn || isConnected != drawnConnected ||
+      batteryLineWidth(isConnected, deviceState.link.phoneBattery) != drawnBatteryWidth) {
+    return false;
+  }
+
+  // Day name and date only change at midnight
+  char dateBuf[DATE_TEXT_MAX];
+  formatDate(dateBuf, sizeof(dateBuf), clock);
+  if (strcmp(dateBuf, drawnDate) != 0) {
+    return false;
+  }
+
+  char timeBuf[TIME_TEXT_MAX];
+  int timeLen = formatTime(timeBuf, sizeof(timeBuf), clock);
+  if (timeLen != (int)strlen(drawnTime)) {
+    return false;
+  }
+  // A glyph of a different width would move every cell after it
+  for (int i = 0; i < timeLen; i++) {
+    if (fontCharWidth(fontLarge, timeBuf[i]) != fontCharWidth(fontLarge, drawnTime[i])) {
+      return false;
+    }
+  }
+
+  // Clear and reblit only the cells that differ
+  uint8_t* buffer = display.getBuffer();
+  int x0 = SCREEN_WIDTH;
+  int x1 = 0;
+  for (int i = 0; i < timeLen; i++) {
+    if (timeBuf[i] == drawnTime[i]) {
+      continue;
+    }
+    int cellW = fontCharWidth(fontLarge, timeBuf[i]);
+    fbFillRect(buffer, timeCellX[i], TIME_TEXT_Y, cellW, fontLarge.height, SSD1306_BLACK);
+    drawText(timeBuf + i, 1, timeCellX[i], TIME_TEXT_Y, fontLarge);
+    x0 = min(x0, (int)timeCellX[i]);
+    x1 = max(x1, timeCellX[i] + cellW);
+    drawnTime[i] = timeBuf[i];
+  }
+
+  dirty.x = x0;
+  dirty.y = TIME_TEXT_Y;
+  dirty.w = x1 > x0 ? x1 - x0 : 0;
+  dirty.h = fontLarge.height;
+  return true;
+}
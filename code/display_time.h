@@ -9,6 +9,7 @@
 #include <Adafruit_SSD1306.h>
 #include <ChronosESP32.h>
 #include <ESP32Time.h>
+#include "display_flush.h"
 
 // Forward declarations
 extern Adafruit_SSD1306 display;
@@ -17,6 +18,9 @@ extern ESP32Time rtc;
 
 // Function declarations
 void displayTime();
+// Redraw only the digit cells that changed since the last frame; false when
+// the battery line, connection or date changed and a full render is needed
+bool updateTime(DisplayRegion& dirty);
 
 #endif // DISPLAY_TIME_H
 
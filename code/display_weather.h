@@ -17,9 +17,11 @@ extern ESP32Time rtc;
 
 // Function declarations
 void displayWeather();
+bool weatherScrolling(); // City header needs frames to scroll
 String getWeatherDescription(int icon);
 void drawWeatherIcon(int icon, int x, int y, int size = 36);
-void updateScrollingText(String text, int maxWidth);
+// scrollEnd: last character the text scrolls to, 0 when it fits
+void updateScrollingText(int scrollEnd, uint32_t textGeneration);
 
 #endif // DISPLAY_WEATHER_H
 
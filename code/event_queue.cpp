@@ -0,0 +1,110 @@
+/*
+ * Event Queue - Lock-free handoff from BLE callbacks to the main loop
+ *
+ * Bounded ring of EVENT_QUEUE_SIZE cells, each with a sequence number
+ * (Vyukov's bounded queue). Producers claim a cell with one compare-exchange
+ * and publish it with a release store; the single consumer in loop() reads
+ * cells in order without any lock. Claiming with a compare-exchange keeps
+ * the queue safe even if callbacks arrive from both the BLE host task and
+ * chronos.loop(). A full queue drops the new event and counts it.
+ *
+ * With LOOP_EVENT_WAIT the loop sleeps on a FreeRTOS event group between
+ * ticks; every push sets its bit, so a BLE event wakes the loop immediately
+ * while the idle task (and automatic light sleep) runs in between.
+ */
+
+#include "event_queue.h"
+#include <atomic>
+
+#if LOOP_EVENT_WAIT
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+#define LOOP_EVENT_PENDING (1 << 0)
+
+static EventGroupHandle_t loopEvents = NULL;
+#endif
+
+static_assert((EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) == 0, "EVENT_QUEUE_SIZE must be a power of two");
+
+struct EventCell {
+  std::atomic<uint32_t> sequence;
+  BleEvent event;
+};
+
+static EventCell eventCells[EVENT_QUEUE_SIZE];
+static std::atomic<uint32_t> enqueuePos(0);
+static uint32_t dequeuePos = 0; // Consumer only
+static std::atomic<uint32_t> droppedEvents(0);
+
+void initEventQueue() {
+  for (uint32_t i = 0; i < EVENT_QUEUE_SIZE; i++) {
+    eventCells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  dequeuePos = 0;
+  droppedEvents.store(0, std::memory_order_relaxed);
+  enqueuePos.store(0, std::memory_order_release);
+#if LOOP_EVENT_WAIT
+  if (loopEvents == NULL) {
+    loopEvents = xEventGroupCreate();
+  }
+#endif
+}
+
+bool pushEvent(const BleEvent& event) {
+  uint32_t pos = enqueuePos.load(std::memory_order_relaxed);
+  EventCell* cell;
+  for (;;) {
+    cell = &eventCells[pos & (EVENT_QUEUE_SIZE - 1)];
+    uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+    int32_t diff = (int32_t)(sequence - pos);
+    if (diff == 0) {
+      // Cell is free for this position; claim it
+      if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        break;
+      }
+    } else if (diff < 0) {
+      // Consumer hasn't freed this cell yet: queue is full
+      droppedEvents.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      pos = enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+  cell->event = event;
+  cell->sequence.store(pos + 1, std::memory_order_release);
+#if LOOP_EVENT_WAIT
+  xEventGroupSetBits(loopEvents, LOOP_EVENT_PENDING);
+#endif
+  return true;
+}
+
+bool popEvent(BleEvent& event) {
+  EventCell* cell = &eventCells[dequeuePos & (EVENT_QUEUE_SIZE - 1)];
+  uint32_t sequence = cell->sequence.load(std::memory_order_acquire);
+  if ((int32_t)(sequence - (dequeuePos + 1)) < 0) {
+    return false; // Empty (or the producer is still writing this cell)
+  }
+  event = cell->event;
+  cell->sequence.store(dequeuePos + EVENT_QUEUE_SIZE, std::memory_order_release);
+  dequeuePos++;
+  return true;
+}
+
+unsigned long getDroppedEvents() {
+  return droppedEvents.load(std::memory_order_relaxed);
+}
+
+void waitForEvents(unsigned long timeoutMs) {
+  // Events left over from a bounded drain are handled without sleeping
+  EventCell* next = &eventCells[dequeuePos & (EVENT_QUEUE_SIZE - 1)];
+  if ((int32_t)(next->sequence.load(std::memory_order_acquire) - (dequeuePos + 1)) >= 0) {
+    return;
+  }
+#if LOOP_EVENT_WAIT
+  // Bit is cleared on exit; events pushed since the last drain return at once
+  xEventGroupWaitBits(loopEvents, LOOP_EVENT_PENDING, pdTRUE, pdFALSE, pdMS_TO_TICKS(timeoutMs));
+#else
+  delay(timeoutMs);
+#endif
+}
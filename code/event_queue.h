@@ -0,0 +1,40 @@
+/*
+ * Event Queue - Lock-free handoff from BLE callbacks to the main loop
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Events raised by ChronosESP32 callbacks
+enum BleEventType : uint8_t {
+  EVENT_NOTIFICATION, // New notification (fields below)
+  EVENT_CONNECTION,   // Phone connected or disconnected
+  EVENT_NAVIGATION,   // Navigation data or icon changed
+  EVENT_WEATHER       // Weather or forecast data received
+};
+
+// Fixed-size event: callbacks copy what they need so the loop never reads
+// library state the BLE stack is writing
+struct BleEvent {
+  BleEventType type;
+  bool connected;                       // EVENT_CONNECTION
+  uint32_t iconCrc;                     // EVENT_NAVIGATION: CRC of a fully received icon, else 0
+  unsigned long receivedUs;             // EVENT_NOTIFICATION: micros() in the callback
+  char app[NOTIFICATION_APP_MAX];       // EVENT_NOTIFICATION
+  char title[NOTIFICATION_TITLE_MAX];   // Header only
+  char message[NOTIFICATION_TEXT_MAX];  // Body: the message, or the full title if there is none
+  bool messageTruncated;                // Body was cut to fit message
+};
+
+// Function declarations
+void initEventQueue();
+bool pushEvent(const BleEvent& event);  // Producer side (callbacks); false if full
+bool popEvent(BleEvent& event);         // Consumer side (loop only)
+unsigned long getDroppedEvents();
+// Block the loop until an event is pushed or timeoutMs passes
+void waitForEvents(unsigned long timeoutMs);
+
+#endif // EVENT_QUEUE_H
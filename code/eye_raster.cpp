@@ -0,0 +1,167 @@
+/*
+ * Eye Raster - Span-table scanline renderer for the eye animation
+ *
+ * Every shape in the eye is a filled circle, so each one is stored as a table
+ * of per-row half-widths built once with the same midpoint algorithm as
+ * Adafruit_GFX::fillCircle. A frame is then composed row by row straight into
+ * the framebuffer: eyeball span (white), pupil span (black), glint span
+ * (white), eyelid notch (black). Only rows inside the eyeball are touched,
+ * instead of the ~140 rows and thousands of clipped pixels the radius-70
+ * eyelid fills used to cost.
+ */
+
+#include "eye_raster.h"
+#include "config.h"
+
+// Per-row half-widths, indexed by |row - center|
+static uint8_t eyeSpan[EYE_RADIUS + 1];
+static uint8_t pupilSpan[PUPIL_RADIUS + 1];
+static uint8_t glintSpan[GLINT_RADIUS + 1];
+static uint8_t lidSpan[EYELID_RADIUS + 1];
+
+// Eyelid circle centers relative to the eye center, per blinkPhase step
+static int8_t topLidOffset[EYE_BLINK_STEPS];
+static int8_t bottomLidOffset[EYE_BLINK_STEPS];
+
+static bool eyeRasterReady = false;
+
+// Fill spans[0..r] with the half-width of each row of a filled circle,
+// matching the pixels Adafruit_GFX::fillCircle(x0, y0, r) sets
+static void buildCircleSpans(uint8_t* spans, int r) {
+  // fillCircle draws vertical lines; record how far each column reaches
+  // and turn that into per-row extents afterwards
+  int8_t columnReach[EYELID_RADIUS + 1];
+  for (int c = 0; c <= r; c++) {
+    columnReach[c] = -1;
+  }
+  columnReach[0] = r;
+
+  int f = 1 - r;
+  int ddF_x = 1;
+  int ddF_y = -2 * r;
+  int x = 0;
+  int y = r;
+  int px = x;
+  int py = y;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < (y + 1) && y > columnReach[x]) {
+      columnReach[x] = y;
+    }
+    if (y != py) {
+      if (px > columnReach[py]) {
+        columnReach[py] = px;
+      }
+      py = y;
+    }
+    px = x;
+  }
+
+  // Column reach shrinks monotonically away from the center, so each row is
+  // one contiguous span out to the widest column that still covers it
+  for (int row = 0; row <= r; row++) {
+    int half = 0;
+    for (int c = 0; c <= r; c++) {
+      if (columnReach[c] >= row) {
+        half = c;
+      }
+    }
+    spans[row] = half;
+  }
+}
+
+// Same integer interpolation the eye used with map_l(), relative to the eye center
+static int lerpPhase(int phase, int from, int to) {
+  return phase * (to - from) / 100 + from;
+}
+
+void initEyeRaster() {
+  buildCircleSpans(eyeSpan, EYE_RADIUS);
+  buildCircleSpans(pupilSpan, PUPIL_RADIUS);
+  buildCircleSpans(glintSpan, GLINT_RADIUS);
+  buildCircleSpans(lidSpan, EYELID_RADIUS);
+
+  // Upper lid: rests overlapping TOP_LID_RESTING pixels, closes at the center
+  int topOpen = -EYE_RADIUS - EYELID_RADIUS + TOP_LID_RESTING + EYELID_CURVE_OFFSET;
+  int topClosed = -EYELID_RADIUS + 1;
+  // Lower lid moves ~35% of the upper lid for an asymmetric blink
+  int botOpen = EYE_RADIUS + EYELID_RADIUS - BOTTOM_LID_RESTING - EYELID_CURVE_OFFSET;
+  int botClosed = EYELID_RADIUS - 1;
+  for (int phase = 0; phase < EYE_BLINK_STEPS; phase++) {
+    topLidOffset[phase] = lerpPhase(phase, topOpen, topClosed);
+    bottomLidOffset[phase] = lerpPhase((phase * 35) / 100, botOpen, botClosed);
+  }
+
+  eyeRasterReady = true;
+}
+
+// Set or clear columns x0..x1 of one framebuffer row
+static inline void fillSpan(uint8_t* row, uint8_t mask, int x0, int x1, bool white) {
+  if (x0 < 0) x0 = 0;
+  if (x1 > SCREEN_WIDTH - 1) x1 = SCREEN_WIDTH - 1;
+  if (white) {
+    for (int x = x0; x <= x1; x++) row[x] |= mask;
+  } else {
+    uint8_t keep = ~mask;
+    for (int x = x0; x <= x1; x++) row[x] &= keep;
+  }
+}
+
+void rasterizeEye(uint8_t* buffer, int eyeCX, int eyeCY, int pupilX, int pupilY, int blinkPhase) {
+  if (!eyeRasterReady) {
+    initEyeRaster();
+  }
+  if (blinkPhase < 0) blinkPhase = 0;
+  if (blinkPhase > EYE_BLINK_STEPS - 1) blinkPhase = EYE_BLINK_STEPS - 1;
+
+  int topLid = topLidOffset[blinkPhase];
+  int bottomLid = bottomLidOffset[blinkPhase];
+  int glintX = pupilX - 3;
+  int glintY = pupilY - 3;
+
+  for (int dy = -EYE_RADIUS; dy <= EYE_RADIUS; dy++) {
+    int y = eyeCY + dy;
+    if (y < 0 || y >= SCREEN_HEIGHT) continue;
+
+    // Eyelid notch: both lids are centered on the eye, so their union on
+    // this row is simply the wider of the two spans
+    int notch = -1;
+    int topDy = abs(dy - topLid);
+    if (topDy <= EYELID_RADIUS) notch = lidSpan[topDy];
+    int bottomDy = abs(bottomLid - dy);
+    if (bottomDy <= EYELID_RADIUS && lidSpan[bottomDy] > notch) notch = lidSpan[bottomDy];
+
+    int half = eyeSpan[abs(dy)];
+    if (notch >= half) continue; // Row fully covered by the lids
+
+    uint8_t* row = buffer + (y >> 3) * SCREEN_WIDTH;
+    uint8_t mask = 1 << (y & 7);
+
+    // A. Base Eye (White)
+    fillSpan(row, mask, eyeCX - half, eyeCX + half, true);
+
+    // B. Pupil (Black)
+    int pupilDy = abs(y - pupilY);
+    if (pupilDy <= PUPIL_RADIUS) {
+      fillSpan(row, mask, pupilX - pupilSpan[pupilDy], pupilX + pupilSpan[pupilDy], false);
+    }
+
+    // C. Glint
+    int glintDy = abs(y - glintY);
+    if (glintDy <= GLINT_RADIUS) {
+      fillSpan(row, mask, glintX - glintSpan[glintDy], glintX + glintSpan[glintDy], true);
+    }
+
+    // D. The Eyelids (Shaping the Eye)
+    if (notch >= 0) {
+      fillSpan(row, mask, eyeCX - notch, eyeCX + notch, false);
+    }
+  }
+}
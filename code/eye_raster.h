@@ -0,0 +1,32 @@
+/*
+ * Eye Raster - Span-table scanline renderer for the eye animation
+ */
+
+#ifndef EYE_RASTER_H
+#define EYE_RASTER_H
+
+#include <Arduino.h>
+
+// --- Eye Geometry ---
+#define EYE_RADIUS 26          // Base white ball size
+#define PUPIL_RADIUS 9         // Slightly smaller pupil for the almond shape
+#define GLINT_RADIUS 3         // Highlight on the pupil
+#define EYELID_RADIUS 70       // Giant masking circle radius (flatter curve)
+
+// --- Natural Shape Tuning ---
+// These control the "Resting Face" shape.
+// 0 = Fully open (shocked). Higher = More closed (sleepy/relaxed).
+#define TOP_LID_RESTING 8      // Top lid covers 8 pixels when "open" (more natural almond)
+#define BOTTOM_LID_RESTING 5   // Bottom lid covers 5 pixels when "open"
+#define EYELID_CURVE_OFFSET 2  // Additional curve offset for more natural shape
+
+#define EYE_BLINK_STEPS 101    // blinkPhase range: 0 (Resting) to 100 (Closed)
+
+// Function declarations
+void initEyeRaster();
+// Compose one eye scanline by scanline into an SSD1306 page-layout framebuffer
+// (128x64, one bit per pixel, 8 rows per byte). Pixels outside the eye's
+// bounding box are left untouched.
+void rasterizeEye(uint8_t* buffer, int eyeCX, int eyeCY, int pupilX, int pupilY, int blinkPhase);
+
+#endif // EYE_RASTER_H
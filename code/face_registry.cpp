@@ -0,0 +1,61 @@
+/*
+ * Face Registry - Compile-time table of display faces
+ *
+ * Rotation is a walk over the registry: the next face after the current one
+ * (wrapping) that is enabled, rotated and has data to show.
+ *
+ * Redraw skipping compares a face's declared inputs against the generations
+ * recorded when the last frame was drawn.
+ */
+
+#include "face_registry.h"
+
+// Input generations as of the last rendered frame
+static uint32_t renderedGenerations[INPUT_COUNT];
+
+static bool isRotationCandidate(const FaceDescriptor& face) {
+  return face.enabled && face.duration > 0 && (face.available == nullptr || face.available());
+}
+
+DisplayMode getFirstEnabledFace() {
+  for (int i = 0; i < FACE_COUNT; i++) {
+    if (faceRegistry[i].enabled && faceRegistry[i].duration > 0) {
+      return faceRegistry[i].mode;
+    }
+  }
+  // If all are disabled, default to time (shouldn't happen in normal use)
+  return MODE_TIME;
+}
+
+DisplayMode getNextEnabledFace(DisplayMode current) {
+  if (faceRegistry[current].duration == 0) {
+    return getFirstEnabledFace(); // Leaving a priority face
+  }
+  for (int step = 1; step < FACE_COUNT; step++) {
+    const FaceDescriptor& face = faceRegistry[(current + step) % FACE_COUNT];
+    if (isRotationCandidate(face)) {
+      return face.mode;
+    }
+  }
+  // Stay on the current face if others are disabled or have no data
+  return current;
+}
+
+bool faceNeedsRender(const FaceDescriptor& face) {
+  if (face.animating != nullptr && face.animating()) {
+    return true;
+  }
+  for (int i = 0; i < INPUT_COUNT; i++) {
+    if ((face.inputs & INPUT_BIT(i)) &&
+        inputGeneration((StateInput)i) != renderedGenerations[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void markFaceRendered() {
+  for (int i = 0; i < INPUT_COUNT; i++) {
+    renderedGenerations[i] = inputGeneration((StateInput)i);
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * Face Registry - Compile-time table of display faces
+ *
+ * One descriptor per DisplayMode, built from config.h. Rotation, the
+ * enabled checks, rotation durations, the frame scheduler's refresh policy,
+ * redraw skipping and region updates all read this table, so adding a face
+ * means adding its mode, its config macros and one row here. A disabled
+ * face's render function is not referenced anywhere, so the linker drops it
+ * (--gc-sections).
+ */
+
+#ifndef FACE_REGISTRY_H
+#define FACE_REGISTRY_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "display_manager.h"
+#include "frame_scheduler.h"
+#include "display_time.h"
+#include "display_weather.h"
+#include "display_forecast.h"
+#include "display_notification.h"
+#include "display_navigation.h"
+#include "display_eye.h"
+#include "device_state.h"
+
+typedef void (*FaceRenderFn)();
+typedef bool (*FaceAvailableFn)();
+typedef bool (*FaceAnimatingFn)();
+typedef bool (*FaceUpdateFn)(DisplayRegion& dirty);
+
+struct FaceDescriptor {
+  DisplayMode mode;          // Must match the row index
+  const char* name;
+  bool enabled;              // ENABLE_*_FACE
+  FaceRenderFn render;       // nullptr when disabled
+  unsigned long duration;    // ms in the rotation, 0 = priority face (not rotated)
+  FaceSchedule schedule;     // Refresh interval and render budget
+  FaceAvailableFn available; // Has data to show, nullptr = always
+  uint16_t inputs;           // INPUT_BIT()s of the DeviceState inputs it draws
+  FaceAnimatingFn animating; // Needs every frame regardless of inputs, nullptr = never
+  FaceUpdateFn update;       // Redraws changed cells over its last frame, nullptr = full render
+};
+
+// Keep disabled faces' code unreferenced
+constexpr FaceRenderFn faceRender(bool enabled, FaceRenderFn render) {
+  return enabled ? render : nullptr;
+}
+
+constexpr FaceUpdateFn faceUpdate(bool enabled, FaceUpdateFn update) {
+  return (enabled && DISPLAY_REGION_UPDATES) ? update : nullptr;
+}
+
+constexpr bool faceAlwaysAnimating() {
+  return true;
+}
+
+// Rotation follows table order: TIME -> WEATHER -> FORECAST -> EYE -> TIME
+inline constexpr FaceDescriptor faceRegistry[] = {
+  { MODE_TIME, "time", ENABLE_TIME_FACE,
+    faceRender(ENABLE_TIME_FACE, displayTime), MODE_TIME_DURATION,
+    { FRAME_INTERVAL_TIME, FRAME_BUDGET_TIME }, nullptr,
+    INPUT_BIT(INPUT_SECOND) | INPUT_BIT(INPUT_MINUTE) | INPUT_BIT(INPUT_BATTERY) |
+    INPUT_BIT(INPUT_CONNECTION), nullptr, faceUpdate(ENABLE_TIME_FACE, updateTime) },
+  { MODE_WEATHER, "weather", ENABLE_WEATHER_FACE,
+    faceRender(ENABLE_WEATHER_FACE, displayWeather), MODE_WEATHER_DURATION,
+    { FRAME_INTERVAL_WEATHER, FRAME_BUDGET_WEATHER }, weatherAvailable,
+    INPUT_BIT(INPUT_WEATHER) | INPUT_BIT(INPUT_MINUTE), weatherScrolling, nullptr },
+  { MODE_FORECAST, "forecast", ENABLE_FORECAST_FACE,
+    faceRender(ENABLE_FORECAST_FACE, displayForecast), MODE_FORECAST_DURATION,
+    { FRAME_INTERVAL_FORECAST, FRAME_BUDGET_FORECAST }, forecastAvailable,
+    INPUT_BIT(INPUT_FORECAST) | INPUT_BIT(INPUT_MINUTE), nullptr, nullptr },
+  { MODE_NOTIFICATION, "notification", ENABLE_NOTIFICATION_FACE,
+    faceRender(ENABLE_NOTIFICATION_FACE, displayNotification), 0,
+    { FRAME_INTERVAL_NOTIFICATION, FRAME_BUDGET_NOTIFICATION }, nullptr,
+    INPUT_BIT(INPUT_NOTIFICATIONS), nullptr, nullptr },
+  { MODE_NAVIGATION, "navigation", ENABLE_NAVIGATION_FACE,
+    faceRender(ENABLE_NAVIGATION_FACE, displayNavigation), 0,
+    { FRAME_INTERVAL_NAVIGATION, FRAME_BUDGET_NAVIGATION }, nullptr,
+    INPUT_BIT(INPUT_NAV) | INPUT_BIT(INPUT_MINUTE), nullptr, nullptr },
+  { MODE_EYE, "eye", ENABLE_EYE_FACE,
+    faceRender(ENABLE_EYE_FACE, displayEye), MODE_EYE_DURATION,
+    { FRAME_INTERVAL_EYE, FRAME_BUDGET_EYE }, nullptr,
+    0, faceAlwaysAnimating, nullptr }
+};
+
+constexpr int FACE_COUNT = sizeof(faceRegistry) / sizeof(faceRegistry[0]);
+
+constexpr const FaceDescriptor& getFace(DisplayMode mode) {
+  return faceRegistry[mode];
+}
+
+constexpr bool faceRegistryIndexed(int i = 0) {
+  return i == FACE_COUNT || (faceRegistry[i].mode == i && faceRegistryIndexed(i + 1));
+}
+
+static_assert(FACE_COUNT == MODE_EYE + 1, "faceRegistry needs one row per DisplayMode");
+static_assert(faceRegistryIndexed(), "faceRegistry rows must be in DisplayMode order");
+
+// Function declarations
+DisplayMode getFirstEnabledFace();                 // Default face (first enabled rotation face)
+DisplayMode getNextEnabledFace(DisplayMode current); // Next enabled face with data, or current
+bool faceNeedsRender(const FaceDescriptor& face); // Animating, or an input changed since the last frame
+void markFaceRendered();                          // Record the input generations just drawn
+
+#endif // FACE_REGISTRY_H
@@ -0,0 +1,76 @@
+/*
+ * Font - Page-layout bitmap fonts with exact metrics
+ *
+ * Text used to go through Adafruit_GFX's classic 5x7 font: every glyph was
+ * five column bytes tested bit by bit into drawPixel() calls (fillRect()
+ * blocks at size 2), and layout code assumed 6px per character. The fonts
+ * in font_data.h store each glyph as column bytes in the panel's own page
+ * layout, so a glyph is blitted with drawPageBitmap() as a few byte-wise
+ * OR/AND operations, and the small font is proportional: narrow glyphs and
+ * spaces no longer take 6px, and widths are measured exactly instead of
+ * estimated.
+ */
+
+#include "font.h"
+#include "font_data.h"
+#include "page_bitmap.h"
+#include "config.h"
+#include <string.h>
+
+const Font fontSmall = {FONT_DATA_FIRST, FONT_DATA_LAST, 8, 1,
+                        fontSmallWidths, fontSmallOffsets, fontSmallBitmaps};
+const Font fontLarge = {FONT_DATA_FIRST, FONT_DATA_LAST, 16, 2,
+                        fontLargeWidths, fontLargeOffsets, fontLargeBitmaps};
+
+// Glyph index of c, with unsupported characters shown as '?'
+static inline int glyphIndex(const Font& font, char c) {
+  uint8_t code = (uint8_t)c;
+  if (code < font.first || code > font.last) {
+    code = '?';
+  }
+  return code - font.first;
+}
+
+int fontCharWidth(const Font& font, char c) {
+  return font.widths[glyphIndex(font, c)];
+}
+
+int fontTextWidth(const Font& font, const char* text, int length) {
+  if (length <= 0) {
+    return 0;
+  }
+  int width = font.spacing * (length - 1);
+  for (int i = 0; i < length; i++) {
+    width += font.widths[glyphIndex(font, text[i])];
+  }
+  return width;
+}
+
+int fontTextWidth(const Font& font, const char* text) {
+  return fontTextWidth(font, text, (int)strlen(text));
+}
+
+int fontFitLength(const Font& font, const char* text, int length, int maxWidth) {
+  int width = -font.spacing;
+  for (int i = 0; i < length; i++) {
+    width += font.spacing + font.widths[glyphIndex(font, text[i])];
+    if (width > maxWidth) {
+      return i;
+    }
+  }
+  return length;
+}
+
+int drawFontText(uint8_t* buffer, const Font& font, int x, int y, const char* text, int length,
+                 uint16_t color) {
+  for (int i = 0; i < length && x < SCREEN_WIDTH; i++) {
+    int glyph = glyphIndex(font, text[i]);
+    int width = font.widths[glyph];
+    // Glyphs left of the screen only advance the pen; spaces have no ink
+    if (x + width > 0 && text[i] != ' ') {
+      drawPageBitmap(buffer, x, y, font.bitmaps + font.offsets[glyph], width, font.height, color);
+    }
+    x += width + font.spacing;
+  }
+  return x;
+}
@@ -0,0 +1,39 @@
+/*
+ * Font - Page-layout bitmap fonts with exact metrics
+ */
+
+#ifndef FONT_H
+#define FONT_H
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+
+// Glyph columns for one character range, in PROGMEM (see font_data.h)
+struct Font {
+  uint8_t first;           // First character code
+  uint8_t last;            // Last character code; others draw as '?'
+  uint8_t height;          // Pixel rows per glyph
+  uint8_t spacing;         // Blank columns between glyphs
+  const uint8_t* widths;   // Columns per glyph
+  const uint16_t* offsets; // Start of each glyph in bitmaps
+  const uint8_t* bitmaps;  // ceil(height/8) pages of width column bytes per glyph
+};
+
+// External fonts
+extern const Font fontSmall; // Proportional 8px, classic glyphs trimmed
+extern const Font fontLarge; // Classic glyphs doubled, 16px (setTextSize(2) look)
+
+// Function declarations
+int fontCharWidth(const Font& font, char c);
+// Exact ink-to-ink width: glyph widths plus spacing between them
+int fontTextWidth(const Font& font, const char* text, int length);
+int fontTextWidth(const Font& font, const char* text);
+// Characters from the start of text that fit in maxWidth pixels
+int fontFitLength(const Font& font, const char* text, int length, int maxWidth);
+// Blit text with its top-left at (x, y) in color (SSD1306_WHITE,
+// SSD1306_BLACK or SSD1306_INVERSE), clipped to the screen. Returns the x
+// where the next glyph would start.
+int drawFontText(uint8_t* buffer, const Font& font, int x, int y, const char* text, int length,
+                 uint16_t color = SSD1306_WHITE);
+
+#endif // FONT_H
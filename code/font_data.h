@@ -0,0 +1,210 @@
+/*
+ * Font Data - Glyph tables for font.cpp
+ *
+ * GENERATED by host/tools/gen_fonts.cpp from the classic GFX font - do not
+ * edit by hand. Characters 0x20-0x7E, glyph columns in page layout.
+ */
+
+#ifndef FONT_DATA_H
+#define FONT_DATA_H
+
+#include <Arduino.h>
+
+#define FONT_DATA_FIRST 0x20
+#define FONT_DATA_LAST 0x7E
+
+// Small: proportional, 8px tall, 1 column between glyphs
+static const uint8_t PROGMEM fontSmallWidths[] = {
+  2, 1, 3, 5, 5, 5, 5, 3, 3, 3, 5, 5, 3, 5, 2, 5, 
+  5, 3, 5, 5, 5, 5, 5, 5, 5, 5, 1, 2, 4, 5, 4, 5, 
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 5, 5, 5, 5, 5, 5, 
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 5, 4, 5, 5, 
+  3, 5, 5, 5, 5, 5, 4, 5, 5, 3, 4, 4, 3, 5, 5, 5, 
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 3, 1, 3, 5
+};
+
+static const uint16_t PROGMEM fontSmallOffsets[] = {
+  0, 2, 3, 6, 11, 16, 21, 26, 29, 32, 35, 40, 
+  45, 48, 53, 55, 60, 65, 68, 73, 78, 83, 88, 93, 
+  98, 103, 108, 109, 111, 115, 120, 124, 129, 134, 139, 144, 
+  149, 154, 159, 164, 169, 174, 177, 182, 187, 192, 197, 202, 
+  207, 212, 217, 222, 227, 232, 237, 242, 247, 252, 257, 262, 
+  266, 271, 275, 280, 285, 288, 293, 298, 303, 308, 313, 317, 
+  322, 327, 330, 334, 338, 341, 346, 351, 356, 361, 366, 371, 
+  376, 381, 386, 391, 396, 401, 406, 411, 414, 415, 418
+};
+
+static const uint8_t PROGMEM fontSmallBitmaps[] = {
+  0x00, 0x00, 0x5F, 0x07, 0x00, 0x07, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x24, 0x2A, 0x7F, 0x2A, 0x12, 
+  0x23, 0x13, 0x08, 0x64, 0x62, 0x36, 0x49, 0x56, 0x20, 0x50, 0x08, 0x07, 0x03, 0x1C, 0x22, 0x41, 
+  0x41, 0x22, 0x1C, 0x2A, 0x1C, 0x7F, 0x1C, 0x2A, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x80, 0x70, 0x30, 
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x60, 0x60, 0x20, 0x10, 0x08, 0x04, 0x02, 0x3E, 0x51, 0x49, 0x45, 
+  0x3E, 0x42, 0x7F, 0x40, 0x72, 0x49, 0x49, 0x49, 0x46, 0x21, 0x41, 0x49, 0x4D, 0x33, 0x18, 0x14, 
+  0x12, 0x7F, 0x10, 0x27, 0x45, 0x45, 0x45, 0x39, 0x3C, 0x4A, 0x49, 0x49, 0x31, 0x41, 0x21, 0x11, 
+  0x09, 0x07, 0x36, 0x49, 0x49, 0x49, 0x36, 0x46, 0x49, 0x49, 0x29, 0x1E, 0x14, 0x40, 0x34, 0x08, 
+  0x14, 0x22, 0x41, 0x14, 0x14, 0x14, 0x14, 0x14, 0x41, 0x22, 0x14, 0x08, 0x02, 0x01, 0x59, 0x09, 
+  0x06, 0x3E, 0x41, 0x5D, 0x59, 0x4E, 0x7C, 0x12, 0x11, 0x12, 0x7C, 0x7F, 0x49, 0x49, 0x49, 0x36, 
+  0x3E, 0x41, 0x41, 0x41, 0x22, 0x7F, 0x41, 0x41, 0x41, 0x3E, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x7F, 
+  0x09, 0x09, 0x09, 0x01, 0x3E, 0x41, 0x41, 0x51, 0x73, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x41, 0x7F, 
+  0x41, 0x20, 0x40, 0x41, 0x3F, 0x01, 0x7F, 0x08, 0x14, 0x22, 0x41, 0x7F, 0x40, 0x40, 0x40, 0x40, 
+  0x7F, 0x02, 0x1C, 0x02, 0x7F, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x7F, 
+  0x09, 0x09, 0x09, 0x06, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x26, 0x49, 
+  0x49, 0x49, 0x32, 0x03, 0x01, 0x7F, 0x01, 0x03, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x1F, 0x20, 0x40, 
+  0x20, 0x1F, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x63, 0x14, 0x08, 0x14, 0x63, 0x03, 0x04, 0x78, 0x04, 
+  0x03, 0x61, 0x59, 0x49, 0x4D, 0x43, 0x7F, 0x41, 0x41, 0x41, 0x02, 0x04, 0x08, 0x10, 0x20, 0x41, 
+  0x41, 0x41, 0x7F, 0x04, 0x02, 0x01, 0x02, 0x04, 0x40, 0x40, 0x40, 0x40, 0x40, 0x03, 0x07, 0x08, 
+  0x20, 0x54, 0x54, 0x78, 0x40, 0x7F, 0x28, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44, 0x28, 0x38, 
+  0x44, 0x44, 0x28, 0x7F, 0x38, 0x54, 0x54, 0x54, 0x18, 0x08, 0x7E, 0x09, 0x02, 0x18, 0xA4, 0xA4, 
+  0x9C, 0x78, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x44, 0x7D, 0x40, 0x20, 0x40, 0x40, 0x3D, 0x7F, 0x10, 
+  0x28, 0x44, 0x41, 0x7F, 0x40, 0x7C, 0x04, 0x78, 0x04, 0x78, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x38, 
+  0x44, 0x44, 0x44, 0x38, 0xFC, 0x18, 0x24, 0x24, 0x18, 0x18, 0x24, 0x24, 0x18, 0xFC, 0x7C, 0x08, 
+  0x04, 0x04, 0x08, 0x48, 0x54, 0x54, 0x54, 0x24, 0x04, 0x04, 0x3F, 0x44, 0x24, 0x3C, 0x40, 0x40, 
+  0x20, 0x7C, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x44, 0x28, 0x10, 0x28, 
+  0x44, 0x4C, 0x90, 0x90, 0x90, 0x7C, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x08, 0x36, 0x41, 0x77, 0x41, 
+  0x36, 0x08, 0x02, 0x01, 0x02, 0x04, 0x02
+};
+
+// Large: classic glyphs doubled, 16px tall, 2 columns between glyphs
+static const uint8_t PROGMEM fontLargeWidths[] = {
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10
+};
+
+static const uint16_t PROGMEM fontLargeOffsets[] = {
+  0, 20, 40, 60, 80, 100, 120, 140, 160, 180, 200, 220, 
+  240, 260, 280, 300, 320, 340, 360, 380, 400, 420, 440, 460, 
+  480, 500, 520, 540, 560, 580, 600, 620, 640, 660, 680, 700, 
+  720, 740, 760, 780, 800, 820, 840, 860, 880, 900, 920, 940, 
+  960, 980, 1000, 1020, 1040, 1060, 1080, 1100, 1120, 1140, 1160, 1180, 
+  1200, 1220, 1240, 1260, 1280, 1300, 1320, 1340, 1360, 1380, 1400, 1420, 
+  1440, 1460, 1480, 1500, 1520, 1540, 1560, 1580, 1600, 1620, 1640, 1660, 
+  1680, 1700, 1720, 1740, 1760, 1780, 1800, 1820, 1840, 1860, 1880
+};
+
+static const uint8_t PROGMEM fontLargeBitmaps[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xFF, 0xFF, 
+  0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 
+  0x30, 0x30, 0xCC, 0xCC, 0xFF, 0xFF, 0xCC, 0xCC, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x3F, 
+  0x0C, 0x0C, 0x03, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x0C, 0x0C, 
+  0x03, 0x03, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 
+  0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30, 0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0x00, 0x00, 0xC0, 0xC0, 
+  0x3F, 0x3F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xF0, 0xF0, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 
+  0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 
+  0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0xCC, 0xCC, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0, 
+  0xCC, 0xCC, 0x0C, 0x0C, 0x03, 0x03, 0x3F, 0x3F, 0x03, 0x03, 0x0C, 0x0C, 0xC0, 0xC0, 0xC0, 0xC0, 
+  0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x3F, 0x3F, 
+  0x0F, 0x0F, 0x00, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xFC, 0xFC, 0x03, 0x03, 0xC3, 0xC3, 0x33, 0x33, 0xFC, 0xFC, 0x0F, 0x0F, 0x33, 0x33, 0x30, 0x30, 
+  0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x0C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x0C, 0x0C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 
+  0x3C, 0x3C, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 0x03, 0x03, 
+  0xC3, 0xC3, 0xF3, 0xF3, 0x0F, 0x0F, 0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 
+  0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 
+  0x3F, 0x3F, 0x03, 0x03, 0x3F, 0x3F, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xC3, 0xC3, 0x0C, 0x0C, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0xF0, 0xF0, 0xCC, 0xCC, 0xC3, 0xC3, 0xC3, 0xC3, 
+  0x03, 0x03, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x03, 0x03, 0x03, 0x03, 
+  0x03, 0x03, 0xC3, 0xC3, 0x3F, 0x3F, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x3C, 0x3C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x0F, 0x0F, 0x3C, 0x3C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFC, 0xFC, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0xC0, 0xC0, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 
+  0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x03, 0x03, 
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 
+  0xC0, 0xC0, 0x00, 0x00, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x00, 0x00, 0x0C, 0x0C, 0x03, 0x03, 
+  0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 
+  0xFC, 0xFC, 0x03, 0x03, 0xF3, 0xF3, 0xC3, 0xC3, 0xFC, 0xFC, 0x0F, 0x0F, 0x30, 0x30, 0x33, 0x33, 
+  0x33, 0x33, 0x30, 0x30, 0xF0, 0xF0, 0x0C, 0x0C, 0x03, 0x03, 0x0C, 0x0C, 0xF0, 0xF0, 0x3F, 0x3F, 
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 
+  0x3C, 0x3C, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0xFC, 0xFC, 0x03, 0x03, 
+  0x03, 0x03, 0x03, 0x03, 0x0C, 0x0C, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 
+  0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x0F, 0x0F, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x3F, 0x3F, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 
+  0x03, 0x03, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03, 
+  0x03, 0x03, 0x03, 0x03, 0x0F, 0x0F, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x3F, 0x3F, 
+  0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 
+  0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 
+  0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 
+  0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x0C, 0x0C, 0xF0, 0xF0, 0x0C, 0x0C, 0xFF, 0xFF, 0x3F, 0x3F, 
+  0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x00, 
+  0xFF, 0xFF, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3F, 0x3F, 0xFC, 0xFC, 0x03, 0x03, 
+  0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 
+  0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x3C, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFC, 0xFC, 0x0F, 0x0F, 
+  0x30, 0x30, 0x33, 0x33, 0x0C, 0x0C, 0x33, 0x33, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 
+  0x3C, 0x3C, 0x3F, 0x3F, 0x00, 0x00, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x3C, 0x3C, 0xC3, 0xC3, 
+  0xC3, 0xC3, 0xC3, 0xC3, 0x0C, 0x0C, 0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 
+  0x0F, 0x0F, 0x03, 0x03, 0xFF, 0xFF, 0x03, 0x03, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x0F, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xFF, 0xFF, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 
+  0xC0, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x0F, 0x30, 0x30, 0x0F, 0x0F, 0x30, 0x30, 0x0F, 0x0F, 
+  0x0F, 0x0F, 0x30, 0x30, 0xC0, 0xC0, 0x30, 0x30, 0x0F, 0x0F, 0x3C, 0x3C, 0x03, 0x03, 0x00, 0x00, 
+  0x03, 0x03, 0x3C, 0x3C, 0x0F, 0x0F, 0x30, 0x30, 0xC0, 0xC0, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 
+  0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0xC3, 0xC3, 0xC3, 0xC3, 0xF3, 0xF3, 
+  0x0F, 0x0F, 0x3C, 0x3C, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0xFF, 0xFF, 
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 
+  0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x03, 0x03, 0x0C, 0x0C, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0x0C, 0x0C, 
+  0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 
+  0x00, 0x00, 0x0F, 0x0F, 0x3F, 0x3F, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0x00, 0x00, 0x0C, 0x0C, 
+  0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0x30, 0x30, 0xFF, 0xFF, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 
+  0xC0, 0xC0, 0x3F, 0x3F, 0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0xC0, 0xC0, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 
+  0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0xFF, 0xFF, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 
+  0x0C, 0x0C, 0x3F, 0x3F, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0x0F, 0x0F, 
+  0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x03, 0x00, 0x00, 0xC0, 0xC0, 0xFC, 0xFC, 0xC3, 0xC3, 
+  0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x30, 0x30, 
+  0x30, 0x30, 0xF0, 0xF0, 0xC0, 0xC0, 0x03, 0x03, 0xCC, 0xCC, 0xCC, 0xCC, 0xC3, 0xC3, 0x3F, 0x3F, 
+  0xFF, 0xFF, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x30, 0x30, 0xF3, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xF3, 
+  0x00, 0x00, 0x0C, 0x0C, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 
+  0xC0, 0xC0, 0x30, 0x30, 0x00, 0x00, 0x3F, 0x3F, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 
+  0x30, 0x30, 0x00, 0x00, 0xF0, 0xF0, 0x30, 0x30, 0xC0, 0xC0, 0x30, 0x30, 0xC0, 0xC0, 0x3F, 0x3F, 
+  0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0xF0, 0xF0, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 
+  0xC0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0xC0, 0xC0, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0x0F, 0x0F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x0F, 0x0F, 
+  0xF0, 0xF0, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0xFF, 0xFF, 0x03, 0x03, 0x0C, 0x0C, 
+  0x0C, 0x0C, 0x03, 0x03, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 0xC0, 0xC0, 0xF0, 0xF0, 0x03, 0x03, 
+  0x0C, 0x0C, 0x0C, 0x0C, 0x03, 0x03, 0xFF, 0xFF, 0xF0, 0xF0, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 
+  0xC0, 0xC0, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x30, 0x30, 
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x0C, 0x0C, 
+  0x30, 0x30, 0x30, 0x30, 0xFF, 0xFF, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 
+  0x30, 0x30, 0x0C, 0x0C, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 
+  0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x3F, 0x3F, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0xF0, 0xF0, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 0xF0, 0xF0, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x0F, 0x0F, 0x30, 0x30, 0x0F, 0x0F, 0x30, 0x30, 0x0F, 0x0F, 
+  0x30, 0x30, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x30, 0x30, 0x30, 0x30, 0x0C, 0x0C, 0x03, 0x03, 
+  0x0C, 0x0C, 0x30, 0x30, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0, 0x30, 0x30, 
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF0, 0xF0, 
+  0x30, 0x30, 0x30, 0x30, 0x3C, 0x3C, 0x33, 0x33, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0xC0, 0xC0, 
+  0x3C, 0x3C, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x30, 0x30, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x3C, 0x3C, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 
+  0x30, 0x30, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x03, 0x03, 0x0C, 0x0C, 0x30, 0x30, 
+  0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+#endif // FONT_DATA_H
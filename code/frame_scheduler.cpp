@@ -0,0 +1,105 @@
+/*
+ * Frame Scheduler - Per-face refresh deadlines and render budgets
+ *
+ * Each face declares how often it needs a new frame and how long a frame may
+ * take (its schedule row in face_registry.h). The display manager asks
+ * whether a frame is due, brackets the render and flush with
+ * beginFrame()/endFrame(), and loop() sleeps until the next deadline instead
+ * of a fixed delay. Static faces (interval 0) are only redrawn on mode or
+ * content changes.
+ */
+
+#include "frame_scheduler.h"
+#include "face_registry.h"
+#include "config.h"
+#include <string.h>
+
+static FrameStats frameStats;
+static DisplayMode scheduledMode = MODE_TIME;
+static bool hasScheduledFrame = false; // No frame drawn yet, or face is static
+static bool deadlineArmed = false;
+static unsigned long nextDeadline = 0;
+static unsigned long frameStartUs = 0;
+static unsigned long frameBudgetUs = 0;
+
+void initFrameScheduler() {
+  memset(&frameStats, 0, sizeof(frameStats));
+  scheduledMode = MODE_TIME;
+  hasScheduledFrame = false;
+  deadlineArmed = false;
+  nextDeadline = 0;
+}
+
+const FaceSchedule& getFaceSchedule(DisplayMode mode) {
+  return getFace(mode).schedule;
+}
+
+bool isFrameDue(DisplayMode mode, unsigned long now) {
+  if (!hasScheduledFrame || mode != scheduledMode) {
+    return true; // First frame of a face
+  }
+  return deadlineArmed && (long)(now - nextDeadline) >= 0;
+}
+
+// Move the deadline past now for a frame that starts (or is skipped) at now
+static void advanceDeadline(DisplayMode mode, unsigned long now) {
+  const FaceSchedule& schedule = getFace(mode).schedule;
+
+  if (hasScheduledFrame && mode == scheduledMode && deadlineArmed &&
+      (long)(now - nextDeadline) >= 0) {
+    // Scheduled frame: keep a fixed cadence from the previous deadline
+    if (now - nextDeadline > FRAME_DEADLINE_SLACK) {
+      frameStats.missedDeadlines++;
+    }
+    nextDeadline += schedule.frameInterval;
+    if ((long)(now - nextDeadline) >= 0) {
+      // Fell a whole frame behind, restart the cadence from now
+      nextDeadline = now + schedule.frameInterval;
+    }
+  } else {
+    // Forced frame (mode switch or new content): restart the cadence
+    nextDeadline = now + schedule.frameInterval;
+  }
+
+  scheduledMode = mode;
+  hasScheduledFrame = true;
+  deadlineArmed = schedule.frameInterval > 0;
+}
+
+void beginFrame(DisplayMode mode, unsigned long now) {
+  advanceDeadline(mode, now);
+  frameBudgetUs = getFace(mode).schedule.budgetUs;
+  frameStartUs = micros();
+}
+
+void skipFrame(DisplayMode mode, unsigned long now) {
+  advanceDeadline(mode, now);
+  frameStats.skippedFrames++;
+}
+
+void endFrame() {
+  unsigned long elapsed = micros() - frameStartUs;
+  frameStats.frames++;
+  frameStats.lastFrameUs = elapsed;
+  if (elapsed > frameStats.maxFrameUs) {
+    frameStats.maxFrameUs = elapsed;
+  }
+  if (elapsed > frameBudgetUs) {
+    frameStats.overBudget++;
+  }
+}
+
+unsigned long msUntilNextFrame(unsigned long now) {
+  if (!deadlineArmed) {
+    return LOOP_MAX_SLEEP;
+  }
+  long remaining = (long)(nextDeadline - now);
+  if (remaining <= 0) {
+    return 0;
+  }
+  return min((unsigned long)remaining, (unsigned long)LOOP_MAX_SLEEP);
+}
+
+const FrameStats& getFrameStats() {
+  return frameStats;
+}
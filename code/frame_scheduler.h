@@ -0,0 +1,37 @@
+/*
+ * Frame Scheduler - Per-face refresh deadlines and render budgets
+ */
+
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Arduino.h>
+#include "display_manager.h"
+
+// Refresh policy declared by each face
+struct FaceSchedule {
+  unsigned long frameInterval; // ms between frames, 0 = redraw only on change
+  unsigned long budgetUs;      // Render + flush submission budget per frame
+};
+
+// Scheduler statistics
+struct FrameStats {
+  unsigned long frames;          // Frames rendered
+  unsigned long skippedFrames;   // Due frames skipped because the face's inputs were unchanged
+  unsigned long missedDeadlines; // Scheduled frames started more than FRAME_DEADLINE_SLACK late
+  unsigned long overBudget;      // Frames that exceeded their face's budget
+  unsigned long lastFrameUs;     // Render + flush time of the last frame
+  unsigned long maxFrameUs;      // Worst frame time seen
+};
+
+// Function declarations
+void initFrameScheduler();
+const FaceSchedule& getFaceSchedule(DisplayMode mode);
+bool isFrameDue(DisplayMode mode, unsigned long now);
+void beginFrame(DisplayMode mode, unsigned long now);
+void endFrame();
+void skipFrame(DisplayMode mode, unsigned long now); // Consume a due frame without rendering
+unsigned long msUntilNextFrame(unsigned long now); // Capped at LOOP_MAX_SLEEP
+const FrameStats& getFrameStats();
+
+#endif // FRAME_SCHEDULER_H
@@ -0,0 +1,65 @@
+/*
+ * Framebuffer - Byte-wise fill and line primitives on the SSD1306 buffer
+ *
+ * Header bars, bottom bars and separators used to go through
+ * Adafruit_GFX::fillRect()/drawLine(), which split every rectangle into
+ * one vertical line per column. In the page layout a full 8-row page span
+ * is a single memset and a partial page is one masked OR/AND/XOR per
+ * column, so a 128x10 header bar is one memset plus 128 masked bytes.
+ */
+
+#include "framebuffer.h"
+#include "config.h"
+#include <string.h>
+
+// Apply mask to count consecutive column bytes
+static inline void applyMask(uint8_t* dst, int count, uint8_t mask, uint16_t color) {
+  switch (color) {
+    case SSD1306_WHITE:
+      if (mask == 0xFF) {
+        memset(dst, 0xFF, count);
+      } else {
+        for (int i = 0; i < count; i++) dst[i] |= mask;
+      }
+      break;
+    case SSD1306_BLACK:
+      if (mask == 0xFF) {
+        memset(dst, 0x00, count);
+      } else {
+        uint8_t keep = ~mask;
+        for (int i = 0; i < count; i++) dst[i] &= keep;
+      }
+      break;
+    case SSD1306_INVERSE:
+      for (int i = 0; i < count; i++) dst[i] ^= mask;
+      break;
+  }
+}
+
+void fbFillRect(uint8_t* buffer, int x, int y, int w, int h, uint16_t color) {
+  // Clip to the screen
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > SCREEN_WIDTH) w = SCREEN_WIDTH - x;
+  if (y + h > SCREEN_HEIGHT) h = SCREEN_HEIGHT - y;
+  if (w <= 0 || h <= 0) {
+    return;
+  }
+
+  int y1 = y + h; // Exclusive
+  for (int page = y >> 3; page <= (y1 - 1) >> 3; page++) {
+    int top = page * 8;
+    int from = y > top ? y - top : 0;
+    int to = y1 < top + 8 ? y1 - top : 8;
+    uint8_t mask = (uint8_t)((0xFF << from) & (0xFF >> (8 - to)));
+    applyMask(buffer + page * SCREEN_WIDTH + x, w, mask, color);
+  }
+}
+
+void fbHLine(uint8_t* buffer, int x, int y, int w, uint16_t color) {
+  fbFillRect(buffer, x, y, w, 1, color);
+}
+
+void fbVLine(uint8_t* buffer, int x, int y, int h, uint16_t color) {
+  fbFillRect(buffer, x, y, 1, h, color);
+}
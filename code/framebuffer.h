@@ -0,0 +1,19 @@
+/*
+ * Framebuffer - Byte-wise fill and line primitives on the SSD1306 buffer
+ */
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+
+// Function declarations
+// Same pixels as the Adafruit_GFX calls of the same shape, written straight
+// into an SSD1306 page-layout buffer (128x64, 8 rows per byte). color is
+// SSD1306_WHITE, SSD1306_BLACK or SSD1306_INVERSE. Clipped to the screen.
+void fbFillRect(uint8_t* buffer, int x, int y, int w, int h, uint16_t color);
+void fbHLine(uint8_t* buffer, int x, int y, int w, uint16_t color);
+void fbVLine(uint8_t* buffer, int x, int y, int h, uint16_t color);
+
+#endif // FRAMEBUFFER_H
@@ -0,0 +1,172 @@
+/*
+ * Latency Trace - Notification-to-glass latency tracing
+ *
+ * onNotification() stamps each event with micros(). The newest notification
+ * is then followed through the loop: ingest (processBleEvents), render (the
+ * notification face draws it) and the flush that carries it to the panel.
+ * With DISPLAY_ASYNC_FLUSH the flush completes on the transfer task, so a
+ * rendered trace is handed to a separate in-flight slot at submission time
+ * (the task is idle then) and the task only stamps that slot; the loop folds
+ * finished traces into the history in pollLatencyTrace().
+ *
+ * With LATENCY_TRACE_SERIAL (off by default, so production builds leave
+ * Serial alone) sending "lat" over Serial prints the summary and the recent
+ * samples:
+ *
+ *   lat,<traced>,<superseded>,<last_us>,<min_us>,<mean_us>,<max_us>
+ *   lat_sample,<ingest_us>,<render_us>,<glass_us>   (newest first)
+ */
+
+#include "latency_trace.h"
+#include <string.h>
+#include <atomic>
+
+enum TraceStage : uint8_t {
+  TRACE_IDLE,
+  TRACE_INGESTED,
+  TRACE_RENDERED
+};
+
+struct PendingTrace {
+  unsigned long receivedUs;
+  unsigned long ingestedUs;
+  unsigned long renderedUs;
+  unsigned long glassUs;
+};
+
+// Loop-owned trace for the newest notification
+static PendingTrace pending;
+static TraceStage pendingStage = TRACE_IDLE;
+
+// Handed to the flush at submission, stamped when the transfer finishes
+static PendingTrace inFlight;
+static std::atomic<bool> inFlightActive(false);
+static std::atomic<bool> inFlightDone(false);
+
+static LatencySample history[LATENCY_HISTORY];
+static int historyHead = 0; // Next slot to write
+static int historyCount = 0;
+static LatencyStats latencyStats;
+
+#if LATENCY_TRACE_SERIAL
+static char commandLine[8];
+static uint8_t commandLength = 0;
+#endif
+
+void initLatencyTrace() {
+  pendingStage = TRACE_IDLE;
+  inFlightActive = false;
+  inFlightDone = false;
+  historyHead = 0;
+  historyCount = 0;
+  memset(&latencyStats, 0, sizeof(latencyStats));
+#if LATENCY_TRACE_SERIAL
+  commandLength = 0;
+  Serial.begin(SERIAL_BAUD);
+#endif
+}
+
+void traceNotificationIngested(unsigned long receivedUs) {
+  if (pendingStage != TRACE_IDLE) {
+    latencyStats.superseded++;
+  }
+  pending.receivedUs = receivedUs;
+  pending.ingestedUs = micros();
+  pendingStage = TRACE_INGESTED;
+}
+
+void traceNotificationRendered() {
+  if (pendingStage == TRACE_INGESTED) {
+    pending.renderedUs = micros();
+    pendingStage = TRACE_RENDERED;
+  }
+}
+
+// Fold a finished in-flight trace into the history
+static void collectTrace() {
+  if (!inFlightDone.load(std::memory_order_acquire)) {
+    return;
+  }
+  LatencySample& sample = history[historyHead];
+  sample.ingestUs = inFlight.ingestedUs - inFlight.receivedUs;
+  sample.renderUs = inFlight.renderedUs - inFlight.receivedUs;
+  sample.glassUs = inFlight.glassUs - inFlight.receivedUs;
+  historyHead = (historyHead + 1) % LATENCY_HISTORY;
+  if (historyCount < LATENCY_HISTORY) historyCount++;
+
+  if (latencyStats.traced == 0 || sample.glassUs < latencyStats.minUs) {
+    latencyStats.minUs = sample.glassUs;
+  }
+  if (sample.glassUs > latencyStats.maxUs) {
+    latencyStats.maxUs = sample.glassUs;
+  }
+  latencyStats.traced++;
+  latencyStats.lastUs = sample.glassUs;
+  latencyStats.totalUs += sample.glassUs;
+
+  inFlightDone.store(false, std::memory_order_relaxed);
+  inFlightActive.store(false, std::memory_order_release);
+}
+
+void traceFlushSubmitted() {
+  collectTrace();
+  if (pendingStage != TRACE_RENDERED || inFlightActive.load(std::memory_order_acquire)) {
+    return;
+  }
+  inFlight = pending;
+  pendingStage = TRACE_IDLE;
+  inFlightActive.store(true, std::memory_order_release);
+}
+
+void traceFlushComplete() {
+  if (!inFlightActive.load(std::memory_order_acquire) ||
+      inFlightDone.load(std::memory_order_relaxed)) {
+    return;
+  }
+  inFlight.glassUs = micros();
+  inFlightDone.store(true, std::memory_order_release);
+}
+
+#if LATENCY_TRACE_SERIAL
+static void printLatency() {
+  unsigned long mean = latencyStats.traced ? latencyStats.totalUs / latencyStats.traced : 0;
+  Serial.printf("lat,%lu,%lu,%lu,%lu,%lu,%lu\n", latencyStats.traced, latencyStats.superseded,
+                latencyStats.lastUs, latencyStats.minUs, mean, latencyStats.maxUs);
+  LatencySample samples[LATENCY_HISTORY];
+  int count = getLatencySamples(samples, LATENCY_HISTORY);
+  for (int i = 0; i < count; i++) {
+    Serial.printf("lat_sample,%lu,%lu,%lu\n", (unsigned long)samples[i].ingestUs,
+                  (unsigned long)samples[i].renderUs, (unsigned long)samples[i].glassUs);
+  }
+}
+#endif
+
+void pollLatencyTrace() {
+  collectTrace();
+#if LATENCY_TRACE_SERIAL
+  while (Serial.available() > 0) {
+    int c = Serial.read();
+    if (c == '\n' || c == '\r') {
+      commandLine[commandLength] = '\0';
+      if (strcmp(commandLine, "lat") == 0) {
+        printLatency();
+      }
+      commandLength = 0;
+    } else if (commandLength < sizeof(commandLine) - 1) {
+      commandLine[commandLength++] = (char)c;
+    }
+  }
+#endif
+}
+
+const LatencyStats& getLatencyStats() {
+  return latencyStats;
+}
+
+int getLatencySamples(LatencySample* out, int maxSamples) {
+  int count = min(historyCount, maxSamples);
+  for (int i = 0; i < count; i++) {
+    out[i] = history[(historyHead - 1 - i + LATENCY_HISTORY) % LATENCY_HISTORY];
+  }
+  return count;
+}
@@ -0,0 +1,38 @@
+/*
+ * Latency Trace - Notification-to-glass latency tracing
+ */
+
+#ifndef LATENCY_TRACE_H
+#define LATENCY_TRACE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// One traced notification, microseconds since onNotification()
+struct LatencySample {
+  uint32_t ingestUs; // Popped from the event queue and laid out
+  uint32_t renderUs; // Drawn into the framebuffer by the notification face
+  uint32_t glassUs;  // Flush containing it finished on the I2C bus
+};
+
+// Rolling summary over every traced notification
+struct LatencyStats {
+  unsigned long traced;     // Notifications that reached the glass
+  unsigned long superseded; // Replaced by a newer notification before being drawn
+  unsigned long lastUs;     // Callback-to-glass latency of the last one
+  unsigned long minUs;
+  unsigned long maxUs;
+  unsigned long totalUs;    // For the mean
+};
+
+// Function declarations
+void initLatencyTrace();
+void traceNotificationIngested(unsigned long receivedUs); // Loop, after addNotification()
+void traceNotificationRendered();                          // Notification face drew the newest entry
+void traceFlushSubmitted();  // flushDisplay(), while the transfer task is idle
+void traceFlushComplete();   // Whichever task finished the transfer
+void pollLatencyTrace();     // Loop: collect finished traces, answer "lat" over Serial
+const LatencyStats& getLatencyStats();
+int getLatencySamples(LatencySample* out, int maxSamples); // Newest first
+
+#endif // LATENCY_TRACE_H
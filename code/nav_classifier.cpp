@@ -0,0 +1,259 @@
+/*
+ * Nav Classifier - Maps navigation direction text to a maneuver icon
+ *
+ * The icon used to be picked by lowercasing a copy of the direction text
+ * and running up to ~40 strstr() scans over it on every 500ms redraw. Now:
+ *
+ *  - every keyword in navKeywords[] is compiled once into an Aho-Corasick
+ *    automaton, so one case-insensitive pass over the text yields the set
+ *    of keyword classes it contains
+ *  - the maneuver is decided from that bit set with the same precedence as
+ *    the old if-chain (roundabout, sharp, U-turn, slight, fork, ramp, keep,
+ *    plain turn, destination, straight)
+ *  - results are memoized by an FNV-1a hash of the text, so redraws of an
+ *    unchanged instruction are a hash and a table lookup
+ *
+ * Other app languages are added by appending rows to navKeywords[]; keywords
+ * are lowercase and may be UTF-8 (bytes >= 0x80 are matched as-is).
+ */
+
+#include "nav_classifier.h"
+#include "config.h"
+#include <ctype.h>
+#include <string.h>
+
+// Keyword classes; a text's classes are OR-ed together
+enum NavKeywordClass : uint32_t {
+  KW_ROUNDABOUT = 1UL << 0,
+  KW_LEFT = 1UL << 1,
+  KW_RIGHT = 1UL << 2,
+  KW_FIRST = 1UL << 3,
+  KW_THIRD = 1UL << 4,
+  KW_SHARP_LEFT = 1UL << 5,
+  KW_SHARP_RIGHT = 1UL << 6,
+  KW_UTURN = 1UL << 7,
+  KW_SLIGHT_LEFT = 1UL << 8,
+  KW_SLIGHT_RIGHT = 1UL << 9,
+  KW_FORK = 1UL << 10,
+  KW_RAMP = 1UL << 11,
+  KW_KEEP_LEFT = 1UL << 12,
+  KW_KEEP_RIGHT = 1UL << 13,
+  KW_DESTINATION = 1UL << 14
+};
+
+struct NavKeyword {
+  const char* text;
+  uint32_t classes;
+};
+
+static constexpr NavKeyword navKeywords[] = {
+  // English
+  {"roundabout", KW_ROUNDABOUT},
+  {"traffic circle", KW_ROUNDABOUT},
+  {"rotary", KW_ROUNDABOUT},
+  {"left", KW_LEFT},
+  {"right", KW_RIGHT},
+  {"1", KW_FIRST},
+  {"first", KW_FIRST},
+  {"3", KW_THIRD},
+  {"third", KW_THIRD},
+  {"sharp left", KW_SHARP_LEFT},
+  {"hard left", KW_SHARP_LEFT},
+  {"sharp right", KW_SHARP_RIGHT},
+  {"hard right", KW_SHARP_RIGHT},
+  {"u-turn", KW_UTURN},
+  {"uturn", KW_UTURN},
+  {"slight left", KW_SLIGHT_LEFT},
+  {"bear left", KW_SLIGHT_LEFT},
+  {"slight right", KW_SLIGHT_RIGHT},
+  {"bear right", KW_SLIGHT_RIGHT},
+  {"fork", KW_FORK},
+  {"ramp", KW_RAMP},
+  {"slip road", KW_RAMP},
+  {"merge", KW_RAMP},
+  {"join", KW_RAMP},
+  {"keep left", KW_KEEP_LEFT},
+  {"keep right", KW_KEEP_RIGHT},
+  {"destination", KW_DESTINATION},
+  {"arrive", KW_DESTINATION},
+  {"reached", KW_DESTINATION},
+};
+
+static constexpr size_t navKeywordChars() {
+  size_t total = 0;
+  for (const NavKeyword& keyword : navKeywords) {
+    for (const char* c = keyword.text; *c; c++) total++;
+  }
+  return total;
+}
+
+// One node per keyword character at most, plus the root
+#define NAV_TRIE_NODES (navKeywordChars() + 1)
+static_assert(NAV_TRIE_NODES <= 0xFFFF, "Nav keyword table too large for 16-bit trie links");
+
+struct TrieNode {
+  uint16_t child;   // First child, 0 = none (the root is never a child)
+  uint16_t sibling; // Next child of the same parent, 0 = none
+  uint16_t fail;    // Node for the longest proper suffix that is also a trie path
+  char c;
+  uint32_t classes; // Classes of every keyword ending here, fail chain included
+};
+
+static TrieNode trie[NAV_TRIE_NODES];
+static uint16_t trieSize = 0;
+static bool classifierReady = false;
+
+struct NavMemo {
+  uint32_t hash;
+  NavManeuver maneuver;
+  bool used;
+};
+
+static NavMemo memo[NAV_CLASSIFY_CACHE];
+static uint8_t memoNext = 0;
+static NavClassifierStats stats;
+
+static uint16_t findChild(uint16_t node, char c) {
+  for (uint16_t child = trie[node].child; child != 0; child = trie[child].sibling) {
+    if (trie[child].c == c) {
+      return child;
+    }
+  }
+  return 0;
+}
+
+static void insertKeyword(const NavKeyword& keyword) {
+  uint16_t node = 0;
+  for (const char* p = keyword.text; *p; p++) {
+    char c = tolower((unsigned char)*p);
+    uint16_t next = findChild(node, c);
+    if (next == 0) {
+      next = trieSize++;
+      trie[next].c = c;
+      trie[next].sibling = trie[node].child;
+      trie[node].child = next;
+    }
+    node = next;
+  }
+  trie[node].classes |= keyword.classes;
+}
+
+void initNavClassifier() {
+  memset(trie, 0, sizeof(trie));
+  trieSize = 1;
+  for (const NavKeyword& keyword : navKeywords) {
+    insertKeyword(keyword);
+  }
+
+  // Breadth-first, so a node's fail target is final before its children's
+  static uint16_t queue[NAV_TRIE_NODES];
+  size_t head = 0;
+  size_t tail = 0;
+  for (uint16_t child = trie[0].child; child != 0; child = trie[child].sibling) {
+    trie[child].fail = 0;
+    queue[tail++] = child;
+  }
+  while (head < tail) {
+    uint16_t node = queue[head++];
+    for (uint16_t child = trie[node].child; child != 0; child = trie[child].sibling) {
+      uint16_t f = trie[node].fail;
+      while (f != 0 && findChild(f, trie[child].c) == 0) {
+        f = trie[f].fail;
+      }
+      trie[child].fail = findChild(f, trie[child].c);
+      trie[child].classes |= trie[trie[child].fail].classes;
+      queue[tail++] = child;
+    }
+  }
+
+  memset(memo, 0, sizeof(memo));
+  memoNext = 0;
+  stats = {};
+  classifierReady = true;
+}
+
+static uint32_t scanKeywords(const char* text) {
+  uint32_t classes = 0;
+  uint16_t node = 0;
+  for (const char* p = text; *p; p++) {
+    char c = tolower((unsigned char)*p);
+    uint16_t next = findChild(node, c);
+    while (next == 0 && node != 0) {
+      node = trie[node].fail;
+      next = findChild(node, c);
+    }
+    node = next;
+    classes |= trie[node].classes;
+  }
+  return classes;
+}
+
+// Same precedence as the original strstr() chain
+static NavManeuver decideManeuver(uint32_t kw) {
+  // 1. Roundabouts
+  if (kw & KW_ROUNDABOUT) {
+    if (kw & (KW_LEFT | KW_FIRST)) return NAV_ROUND_LEFT;
+    if (kw & (KW_RIGHT | KW_THIRD)) return NAV_ROUND_RIGHT;
+    return NAV_ROUND_STRAIGHT; // 2nd exit / straight
+  }
+  // 2. Sharp Turns
+  if (kw & KW_SHARP_LEFT) return NAV_SHARP_LEFT;
+  if (kw & KW_SHARP_RIGHT) return NAV_SHARP_RIGHT;
+  // 3. U-Turns
+  if (kw & KW_UTURN) return NAV_UTURN;
+  // 4. Slight Turns / Bear
+  if (kw & KW_SLIGHT_LEFT) return NAV_SLIGHT_LEFT;
+  if (kw & KW_SLIGHT_RIGHT) return NAV_SLIGHT_RIGHT;
+  // 5. Forks
+  if (kw & KW_FORK) return (kw & KW_LEFT) ? NAV_FORK_LEFT : NAV_FORK_RIGHT;
+  // 6. Ramps & Merges: a ramp to one side looks like a slight turn on 1-bit
+  if (kw & KW_RAMP) {
+    if (kw & KW_LEFT) return NAV_SLIGHT_LEFT;
+    if (kw & KW_RIGHT) return NAV_SLIGHT_RIGHT;
+    return NAV_MERGE;
+  }
+  // 7. Keep Left / Right (no dedicated keep-right icon)
+  if (kw & KW_KEEP_LEFT) return NAV_KEEP_LEFT;
+  if (kw & KW_KEEP_RIGHT) return NAV_SLIGHT_RIGHT;
+  // 8. Regular Turns
+  if (kw & KW_LEFT) return NAV_LEFT;
+  if (kw & KW_RIGHT) return NAV_RIGHT;
+  // 9. Destination
+  if (kw & KW_DESTINATION) return NAV_DESTINATION;
+  return NAV_STRAIGHT;
+}
+
+NavManeuver matchDirection(const char* direction) {
+  if (!classifierReady) {
+    initNavClassifier();
+  }
+  return decideManeuver(scanKeywords(direction));
+}
+
+NavManeuver classifyDirection(const char* direction) {
+  if (!classifierReady) {
+    initNavClassifier();
+  }
+
+  // FNV-1a over the raw text
+  uint32_t hash = 2166136261UL;
+  for (const char* p = direction; *p; p++) {
+    hash = (hash ^ (uint8_t)*p) * 16777619UL;
+  }
+  for (int i = 0; i < NAV_CLASSIFY_CACHE; i++) {
+    if (memo[i].used && memo[i].hash == hash) {
+      stats.hits++;
+      return memo[i].maneuver;
+    }
+  }
+
+  stats.misses++;
+  NavManeuver maneuver = decideManeuver(scanKeywords(direction));
+  memo[memoNext] = {hash, maneuver, true};
+  memoNext = (memoNext + 1) % NAV_CLASSIFY_CACHE;
+  return maneuver;
+}
+
+const NavClassifierStats& getNavClassifierStats() {
+  return stats;
+}
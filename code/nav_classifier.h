@@ -0,0 +1,45 @@
+/*
+ * Nav Classifier - Maps navigation direction text to a maneuver icon
+ */
+
+#ifndef NAV_CLASSIFIER_H
+#define NAV_CLASSIFIER_H
+
+#include <Arduino.h>
+
+// One per navigation bitmap in nav_icons.h
+enum NavManeuver : uint8_t {
+  NAV_STRAIGHT,
+  NAV_LEFT,
+  NAV_RIGHT,
+  NAV_SLIGHT_LEFT,
+  NAV_SLIGHT_RIGHT,
+  NAV_SHARP_LEFT,
+  NAV_SHARP_RIGHT,
+  NAV_UTURN,
+  NAV_ROUND_STRAIGHT,
+  NAV_ROUND_LEFT,
+  NAV_ROUND_RIGHT,
+  NAV_FORK_LEFT,
+  NAV_FORK_RIGHT,
+  NAV_MERGE,
+  NAV_KEEP_LEFT,
+  NAV_DESTINATION,
+  NAV_MANEUVER_COUNT
+};
+
+// Memo hits/misses of classifyDirection()
+struct NavClassifierStats {
+  unsigned long hits;
+  unsigned long misses;
+};
+
+// Function declarations
+void initNavClassifier();
+// Memoized by a hash of the text: a route only changes a few times a minute
+NavManeuver classifyDirection(const char* direction);
+// One case-insensitive pass over the text, no memo
+NavManeuver matchDirection(const char* direction);
+const NavClassifierStats& getNavClassifierStats();
+
+#endif // NAV_CLASSIFIER_H
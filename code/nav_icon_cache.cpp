@@ -0,0 +1,117 @@
+/*
+ * Nav Icon Cache - Phone-supplied turn icons, scaled once to the icon slot
+ *
+ * The Chronos navigation payload can carry the app's own turn icon, which
+ * is right for lanes, exits and ramps where the keyword guess is not. It
+ * arrives as a NAV_PHONE_ICON_W square bitmap; the navigation face has a
+ * 32x32 slot. Each distinct icon is area-averaged down once, keyed by the
+ * CRC the library sends with it, and kept in a NAV_ICON_CACHE_SIZE slot cache
+ * (least recently used is replaced) in the panel's page layout, so frames
+ * stay a plain drawPageBitmap().
+ */
+
+#include "nav_icon_cache.h"
+#include "nav_icons.h"
+#include "page_bitmap.h"
+#include "config.h"
+#include <string.h>
+
+#define NAV_ICON_BYTES PAGE_BITMAP_BYTES(ICON_W, ICON_H)
+
+static_assert(NAV_PHONE_ICON_W % 8 == 0, "Phone icon rows must be whole bytes");
+static_assert(NAV_PHONE_ICON_W >= ICON_W && NAV_PHONE_ICON_W >= ICON_H, "Phone icons are only scaled down");
+
+struct CachedNavIcon {
+  uint32_t crc;
+  unsigned long lastUsed;
+  bool used;
+  uint8_t bits[NAV_ICON_BYTES];
+};
+
+static CachedNavIcon iconCache[NAV_ICON_CACHE_SIZE];
+static unsigned long useCounter = 0;
+static NavIconStats stats;
+
+void initNavIconCache() {
+  memset(iconCache, 0, sizeof(iconCache));
+  useCounter = 0;
+  stats = {};
+}
+
+static inline bool rawPixel(const uint8_t* raw, int x, int y) {
+  return raw[y * (NAV_PHONE_ICON_W / 8) + (x >> 3)] & (0x80 >> (x & 7));
+}
+
+// Overlap of source pixel s with destination pixel d on one axis, in units
+// where a source pixel is dstSize long and a destination pixel srcSize long
+static inline int overlap(int s, int d, int srcSize, int dstSize) {
+  int lo = max(s * dstSize, d * srcSize);
+  int hi = min((s + 1) * dstSize, (d + 1) * srcSize);
+  return hi > lo ? hi - lo : 0;
+}
+
+// Area-averaging downscale; a pixel is set when at least a third of it is
+// covered, so one-pixel strokes in the phone icon survive the reduction
+static void scaleIcon(const uint8_t* raw, uint8_t* out) {
+  const int src = NAV_PHONE_ICON_W;
+  memset(out, 0, NAV_ICON_BYTES);
+  for (int dy = 0; dy < ICON_H; dy++) {
+    int sy0 = dy * src / ICON_H;
+    int sy1 = ((dy + 1) * src + ICON_H - 1) / ICON_H;
+    for (int dx = 0; dx < ICON_W; dx++) {
+      int sx0 = dx * src / ICON_W;
+      int sx1 = ((dx + 1) * src + ICON_W - 1) / ICON_W;
+      long covered = 0;
+      for (int sy = sy0; sy < sy1; sy++) {
+        int wy = overlap(sy, dy, src, ICON_H);
+        for (int sx = sx0; sx < sx1; sx++) {
+          if (rawPixel(raw, sx, sy)) {
+            covered += (long)wy * overlap(sx, dx, src, ICON_W);
+          }
+        }
+      }
+      // Full destination pixel = src * src units
+      if (covered * 3 >= (long)src * src) {
+        out[(dy >> 3) * ICON_W + dx] |= 1 << (dy & 7);
+      }
+    }
+  }
+}
+
+static CachedNavIcon* findIcon(uint32_t crc) {
+  for (int i = 0; i < NAV_ICON_CACHE_SIZE; i++) {
+    if (iconCache[i].used && iconCache[i].crc == crc) {
+      return &iconCache[i];
+    }
+  }
+  return NULL;
+}
+
+void storeNavIcon(const uint8_t* raw, uint32_t crc) {
+  CachedNavIcon* entry = findIcon(crc);
+  if (entry != NULL) {
+    stats.hits++;
+  } else {
+    // Reuse an empty or the least recently used slot
+    entry = &iconCache[0];
+    for (int i = 1; i < NAV_ICON_CACHE_SIZE && entry->used; i++) {
+      if (!iconCache[i].used || iconCache[i].lastUsed < entry->lastUsed) {
+        entry = &iconCache[i];
+      }
+    }
+    scaleIcon(raw, entry->bits);
+    entry->crc = crc;
+    entry->used = true;
+    stats.scales++;
+  }
+  entry->lastUsed = ++useCounter;
+}
+
+const uint8_t* getNavIcon(uint32_t crc) {
+  CachedNavIcon* entry = findIcon(crc);
+  return entry != NULL ? entry->bits : NULL;
+}
+
+const NavIconStats& getNavIconStats() {
+  return stats;
+}
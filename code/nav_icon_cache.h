@@ -0,0 +1,25 @@
+/*
+ * Nav Icon Cache - Phone-supplied turn icons, scaled once to the icon slot
+ */
+
+#ifndef NAV_ICON_CACHE_H
+#define NAV_ICON_CACHE_H
+
+#include <Arduino.h>
+
+// Scale/lookup counters
+struct NavIconStats {
+  unsigned long scales; // Distinct icons downscaled
+  unsigned long hits;   // Icons already in the cache
+};
+
+// Function declarations
+void initNavIconCache();
+// Cache the phone's raw NAV_PHONE_ICON_W square icon (1 bpp, MSB-first
+// rows, as Adafruit_GFX::drawBitmap) under crc, the library's Navigation::iconCRC
+void storeNavIcon(const uint8_t* raw, uint32_t crc);
+// ICON_W x ICON_H page-layout bitmap for drawPageBitmap(), or NULL if not cached
+const uint8_t* getNavIcon(uint32_t crc);
+const NavIconStats& getNavIconStats();
+
+#endif // NAV_ICON_CACHE_H
@@ -1,37 +1,94 @@
 /*
  * Notification Queue - Manages notification queue and display timing
+ *
+ * Entries live in a fixed ring buffer of MAX_NOTIFICATIONS slots with inline
+ * char storage. Enqueue, drop-oldest on overflow and expiry of the displayed
+ * entry (always the oldest or the newest) are all O(1) and allocation-free.
  */
 
 #include "notification_queue.h"
 #include "config.h"
 
+// Static RAM budget for the queue storage
+static_assert(sizeof(QueuedNotification) * MAX_NOTIFICATIONS <= NOTIFICATION_RAM_BUDGET,
+              "Notification queue exceeds NOTIFICATION_RAM_BUDGET; lower MAX_NOTIFICATIONS or the *_MAX sizes");
+#define NQ_STR2(x) #x
+#define NQ_STR(x) NQ_STR2(x)
+#pragma message("Notification queue: " NQ_STR(MAX_NOTIFICATIONS) " entries, budget " NQ_STR(NOTIFICATION_RAM_BUDGET) " bytes")
+
 // Notification queue
-Notification notificationQueue[MAX_NOTIFICATIONS];
+static QueuedNotification notificationRing[MAX_NOTIFICATIONS];
+static int notificationHead = 0; // Ring slot of the oldest entry
 int notificationQueueCount = 0;
 int currentNotificationIndex = 0;
 unsigned long notificationStartTime = 0;
+char notificationCounterText[8] = "";
+int notificationCounterX = 0;
+uint32_t notificationGeneration = 0;
+
+// Ring slot of a logical queue index (0 = oldest)
+static inline int ringSlot(int index) {
+  return (notificationHead + index) % MAX_NOTIFICATIONS;
+}
+
+// Refresh the right-aligned "n/N" counter after the index or count changes;
+// every such change also means the face shows something new
+static void updateNotificationCounter() {
+  notificationGeneration++;
+  int length = snprintf(notificationCounterText, sizeof(notificationCounterText), "%d/%d",
+                        currentNotificationIndex + 1, notificationQueueCount);
+  notificationCounterX = SCREEN_WIDTH - fontTextWidth(fontSmall, notificationCounterText, length) - 2; // 2px right margin
+}
 
 void initNotificationQueue() {
+  notificationHead = 0;
   notificationQueueCount = 0;
   currentNotificationIndex = 0;
   notificationStartTime = 0;
+  notificationCounterText[0] = '\0';
+  notificationGeneration++;
 }
 
-void addNotification(Notification notification) {
-  // Add to queue if not full, otherwise shift and add
-  if (notificationQueueCount < MAX_NOTIFICATIONS) {
-    notificationQueue[notificationQueueCount] = notification;
-    notificationQueueCount++;
-  } else {
-    // Shift queue left and add new notification at end
-    for (int i = 0; i < MAX_NOTIFICATIONS - 1; i++) {
-      notificationQueue[i] = notificationQueue[i + 1];
-    }
-    notificationQueue[MAX_NOTIFICATIONS - 1] = notification;
+void addNotification(const char* app, const char* title, const char* message, bool truncated) {
+  // Add to queue if not full, otherwise drop the oldest entry
+  if (notificationQueueCount == MAX_NOTIFICATIONS) {
+    notificationHead = (notificationHead + 1) % MAX_NOTIFICATIONS;
+    notificationQueueCount--;
+  }
+  QueuedNotification& entry = notificationRing[ringSlot(notificationQueueCount)];
+  notificationQueueCount++;
+
+  // Truncate and sanitize into the slot, then word-wrap the message once so
+  // the face only blits lines
+  normalizeText(entry.app, sizeof(entry.app), app);
+  normalizeText(entry.title, sizeof(entry.title), title);
+  const char* source = (message && message[0] != '\0') ? message : title; // Fallback to title if no message
+  bool cut = false;
+  if (normalizeText(entry.text, sizeof(entry.text), source, &cut) == 0) {
+    normalizeText(entry.text, sizeof(entry.text), "No content");
+  }
+  layoutText(entry.text, NOTIFICATION_TEXT_WIDTH, NOTIFICATION_TEXT_LINES, entry.layout);
+  // A message cut at NOTIFICATION_TEXT_MAX can still fit the lines; it must
+  // not look complete
+  if (truncated || cut) {
+    truncateLayout(entry.text, NOTIFICATION_TEXT_WIDTH, entry.layout);
   }
   
   currentNotificationIndex = notificationQueueCount - 1;
   notificationStartTime = millis();
+  updateNotificationCounter();
+}
+
+void addNotification(const Notification& notification) {
+  addNotification(notification.app.c_str(), notification.title.c_str(), notification.message.c_str());
+}
+
+const QueuedNotification& getNotification(int index) {
+  return notificationRing[ringSlot(index)];
+}
+
+const QueuedNotification& getCurrentNotification() {
+  return getNotification(currentNotificationIndex);
 }
 
 void processNotificationQueue(unsigned long currentTime, bool navActive) {
@@ -44,11 +101,12 @@ void processNotificationQueue(unsigned long currentTime, bool navActive) {
   
   // Check if current notification has expired
   if ((currentTime - notificationStartTime) >= notificationTimeout) {
-    // Remove displayed notification from queue
-    for (int i = currentNotificationIndex; i < notificationQueueCount - 1; i++) {
-      notificationQueue[i] = notificationQueue[i + 1];
+    // Remove displayed notification from queue. It is always the oldest
+    // (after an expiry) or the newest (after an add), so this is O(1)
+    if (currentNotificationIndex == 0) {
+      notificationHead = (notificationHead + 1) % MAX_NOTIFICATIONS;
     }
-    notificationQueueCount--;
+    notificationQueueCount--; // The newest simply drops off the tail
     
     // If more notifications, show next one
     if (notificationQueueCount > 0) {
@@ -57,6 +115,7 @@ void processNotificationQueue(unsigned long currentTime, bool navActive) {
     } else {
       currentNotificationIndex = 0;
     }
+    updateNotificationCounter();
   }
 }
 
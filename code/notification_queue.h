@@ -8,18 +8,33 @@
 #include <Arduino.h>
 #include <ChronosESP32.h>
 #include "config.h"
+#include "text_layout.h"
 
-// Notification queue
-extern Notification notificationQueue[MAX_NOTIFICATIONS];
+// Queue entry: fixed-size copies of the notification fields, truncated and
+// laid out once at ingest so the queue never touches the heap
+struct QueuedNotification {
+  char app[NOTIFICATION_APP_MAX];     // Sanitized app name
+  char title[NOTIFICATION_TITLE_MAX]; // Sanitized title
+  char text[NOTIFICATION_TEXT_MAX];   // Sanitized message (falls back to title)
+  TextLayout layout;                  // Line table into text, ellipsis applied
+};
+
+// Notification queue state (entries live in a ring buffer, see getNotification())
 extern int notificationQueueCount;
-extern int currentNotificationIndex;
+extern int currentNotificationIndex;    // Logical index, 0 = oldest
 extern unsigned long notificationStartTime;
+extern char notificationCounterText[8]; // "n/N" for the current entry
+extern int notificationCounterX;        // Right-aligned X of the counter
+extern uint32_t notificationGeneration; // Increments whenever the shown entry or counter changes
 
 // Function declarations
 void initNotificationQueue();
-void addNotification(Notification notification);
+// truncated: message was already cut short by the caller
+void addNotification(const char* app, const char* title, const char* message, bool truncated = false);
+void addNotification(const Notification& notification);
+const QueuedNotification& getNotification(int index);
+const QueuedNotification& getCurrentNotification();
 void processNotificationQueue(unsigned long currentTime, bool navActive);
 bool hasActiveNotification(unsigned long currentTime, bool navActive);
 
 #endif // NOTIFICATION_QUEUE_H
-
@@ -0,0 +1,69 @@
+/*
+ * Page Bitmap - Blitter for bitmaps stored in the SSD1306 page layout
+ *
+ * Icons used to be drawn with Adafruit_GFX::drawBitmap() from row-major
+ * bitmaps: one bit test and one drawPixel() per pixel, 1024 for a 32x32
+ * icon. Stored in the panel's own layout (8 vertical pixels per byte), a
+ * page-aligned icon is a straight byte-wise OR of whole column runs into
+ * the framebuffer; for an unaligned y each source byte is split across two
+ * destination pages with one shift. A 32x32 icon is 128 or 256 byte ops.
+ *
+ * Bitmaps live in PROGMEM, which is memory-mapped flash on the ESP32, so
+ * they are read directly.
+ */
+
+#include "page_bitmap.h"
+#include "config.h"
+
+// Combine count source bytes, shifted by shift (> 0 down, < 0 up), into dst
+static inline void blitRun(uint8_t* dst, const uint8_t* src, int count, int shift, uint16_t color) {
+  int left = shift > 0 ? shift : 0;
+  int right = shift < 0 ? -shift : 0;
+  switch (color) {
+    case SSD1306_WHITE:
+      for (int i = 0; i < count; i++) dst[i] |= (uint8_t)((src[i] << left) >> right);
+      break;
+    case SSD1306_BLACK:
+      for (int i = 0; i < count; i++) dst[i] &= (uint8_t)~((src[i] << left) >> right);
+      break;
+    case SSD1306_INVERSE:
+      for (int i = 0; i < count; i++) dst[i] ^= (uint8_t)((src[i] << left) >> right);
+      break;
+  }
+}
+
+void drawPageBitmap(uint8_t* buffer, int x, int y, const uint8_t* bitmap, int w, int h,
+                    uint16_t color) {
+  if (w <= 0 || h <= 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT || x + w <= 0 || y + h <= 0) {
+    return;
+  }
+
+  // Horizontal clip: columns [col0, col1) of the bitmap
+  int col0 = x < 0 ? -x : 0;
+  int col1 = x + w > SCREEN_WIDTH ? SCREEN_WIDTH - x : w;
+  int runLength = col1 - col0;
+
+  int pages = (h + 7) / 8;
+  int shift = y & 7;
+  int firstPage = y >> 3; // Arithmetic shift: -1 for y in [-8, -1]
+  const int screenPages = SCREEN_HEIGHT / 8;
+
+  for (int page = 0; page < pages; page++) {
+    const uint8_t* src = bitmap + page * w + col0;
+    int destPage = firstPage + page;
+
+    if (shift == 0) {
+      if (destPage < 0 || destPage >= screenPages) continue;
+      blitRun(buffer + destPage * SCREEN_WIDTH + x + col0, src, runLength, 0, color);
+      continue;
+    }
+
+    // Unaligned: low bits land in destPage, the rest in the page below
+    if (destPage >= 0 && destPage < screenPages) {
+      blitRun(buffer + destPage * SCREEN_WIDTH + x + col0, src, runLength, shift, color);
+    }
+    if (destPage + 1 >= 0 && destPage + 1 < screenPages) {
+      blitRun(buffer + (destPage + 1) * SCREEN_WIDTH + x + col0, src, runLength, shift - 8, color);
+    }
+  }
+}
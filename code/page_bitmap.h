@@ -0,0 +1,23 @@
+/*
+ * Page Bitmap - Blitter for bitmaps stored in the SSD1306 page layout
+ */
+
+#ifndef PAGE_BITMAP_H
+#define PAGE_BITMAP_H
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+
+// Bytes of a w x h bitmap in page layout
+#define PAGE_BITMAP_BYTES(w, h) ((w) * (((h) + 7) / 8))
+
+// Function declarations
+// Draw a page-layout bitmap (ceil(h/8) pages of w column bytes, LSB = top
+// row, as the SSD1306 framebuffer) into buffer at (x, y), like
+// drawBitmap(..., color): set bits are drawn in color (SSD1306_WHITE,
+// SSD1306_BLACK or SSD1306_INVERSE), clear bits are transparent. Clipped
+// to the screen.
+void drawPageBitmap(uint8_t* buffer, int x, int y, const uint8_t* bitmap, int w, int h,
+                    uint16_t color = SSD1306_WHITE);
+
+#endif // PAGE_BITMAP_H
@@ -0,0 +1,102 @@
+/*
+ * Power Manager - ESP-IDF power management (light sleep, frequency scaling)
+ *
+ * With POWER_LIGHT_SLEEP the idle task may put the chip into light sleep
+ * whenever no task is runnable, i.e. while loop() waits for events between
+ * frames. Drivers that need clocks (I2C transfers, the BLE controller)
+ * hold their own power management locks, so sleep only happens when it is
+ * safe.
+ *
+ * With POWER_DFS the CPU idles at CPU_FREQ_MIN_MHZ and a CPU_FREQ_MAX lock
+ * boosts it to CPU_FREQ_MAX_MHZ only while a frame is rendered or flushed.
+ * esp_pm locks are counted, so the render boost and the flush task's boost
+ * can overlap on the same handle.
+ */
+
+#include "power_manager.h"
+#include "config.h"
+#include <string.h>
+
+#if POWER_LIGHT_SLEEP || POWER_DFS
+#include "esp_pm.h"
+#endif
+
+static PowerStats powerStats;
+static unsigned long boostStartUs = 0;
+
+#if POWER_DFS
+static esp_pm_lock_handle_t boostLock = NULL;
+#endif
+
+void initPowerManagement() {
+  memset(&powerStats, 0, sizeof(powerStats));
+
+#if POWER_LIGHT_SLEEP || POWER_DFS
+  esp_pm_config_t pmConfig = {
+#if POWER_DFS
+    .max_freq_mhz = CPU_FREQ_MAX_MHZ,
+    .min_freq_mhz = CPU_FREQ_MIN_MHZ,
+#else
+    .max_freq_mhz = CPU_FREQ_MHZ,
+    .min_freq_mhz = CPU_FREQ_MHZ,
+#endif
+    .light_sleep_enable = POWER_LIGHT_SLEEP
+  };
+  // Fails with ESP_ERR_NOT_SUPPORTED if the core was built without
+  // CONFIG_PM_ENABLE; fall back to the fixed low-power clock
+  if (esp_pm_configure(&pmConfig) != ESP_OK) {
+    setCpuFrequencyMhz(CPU_FREQ_MHZ);
+    return;
+  }
+#if POWER_DFS
+  if (boostLock == NULL &&
+      esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "render", &boostLock) == ESP_OK) {
+    powerStats.scalingActive = true;
+  }
+#endif
+#else
+  setCpuFrequencyMhz(CPU_FREQ_MHZ);
+#endif
+}
+
+void beginCpuBoost() {
+#if POWER_DFS
+  if (boostLock != NULL) {
+    esp_pm_lock_acquire(boostLock);
+  }
+#endif
+  powerStats.boosts++;
+  boostStartUs = micros();
+}
+
+void endCpuBoost() {
+  unsigned long elapsed = micros() - boostStartUs;
+  powerStats.lastBoostUs = elapsed;
+  powerStats.boostedUs += elapsed;
+#if POWER_DFS
+  if (boostLock != NULL) {
+    esp_pm_lock_release(boostLock);
+  }
+#endif
+}
+
+void beginFlushBoost() {
+#if POWER_DFS
+  if (boostLock != NULL) {
+    esp_pm_lock_acquire(boostLock);
+  }
+#endif
+  powerStats.flushBoosts++;
+}
+
+void endFlushBoost() {
+#if POWER_DFS
+  if (boostLock != NULL) {
+    esp_pm_lock_release(boostLock);
+  }
+#endif
+}
+
+const PowerStats& getPowerStats() {
+  return powerStats;
+}
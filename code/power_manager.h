@@ -0,0 +1,27 @@
+/*
+ * Power Manager - ESP-IDF power management (light sleep, frequency scaling)
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+
+// Frequency scaling statistics
+struct PowerStats {
+  unsigned long boosts;      // Frames rendered with the CPU boosted
+  unsigned long flushBoosts; // Background transfers run with the CPU boosted
+  unsigned long boostedUs;   // Total time the render boost was held
+  unsigned long lastBoostUs; // Length of the last render boost
+  bool scalingActive;        // esp_pm accepted the DFS configuration
+};
+
+// Function declarations
+void initPowerManagement();
+void beginCpuBoost();      // Run at CPU_FREQ_MAX_MHZ until endCpuBoost()
+void endCpuBoost();
+void beginFlushBoost();    // Same lock, taken by the flush task around a transfer
+void endFlushBoost();
+const PowerStats& getPowerStats();
+
+#endif // POWER_MANAGER_H
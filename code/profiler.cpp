@@ -0,0 +1,126 @@
+/*
+ * Profiler - Optional per-stage cycle timing with histograms over Serial
+ *
+ * Stages are timed with the CPU cycle counter and converted to nanoseconds
+ * at the clock running when the stage ends (render and flush run entirely
+ * under the CPU boost, so they convert exactly; PROFILE_LOOP can straddle
+ * a frequency switch and is approximate under DFS).
+ *
+ * Each stage keeps exact count/min/max plus a fixed log-scale histogram with
+ * four buckets per octave (~19% resolution) from which p50/p99 are read.
+ * Every PROFILE_DUMP_INTERVAL one line per active stage is printed:
+ *
+ *   prof,<stage>,<count>,<min_ns>,<p50_ns>,<p99_ns>,<max_ns>
+ *
+ * and the histograms are reset, so each line covers one interval.
+ */
+
+#include "profiler.h"
+
+#if PROFILE_STAGES
+
+#include <string.h>
+
+// Bucket 0 holds everything below 2^PROFILE_MIN_OCTAVE ns; bucket i > 0
+// covers a quarter octave starting at 2^PROFILE_MIN_OCTAVE ns
+#define PROFILE_MIN_OCTAVE 6
+#define PROFILE_BUCKETS 96
+
+struct StageHistogram {
+  uint32_t count;
+  uint32_t minNs;
+  uint32_t maxNs;
+  uint16_t buckets[PROFILE_BUCKETS];
+};
+
+static const char* const stageNames[PROFILE_STAGE_COUNT] = {
+  "loop", "chronos", "events", "mode_logic",
+  "render_time", "render_weather", "render_forecast",
+  "render_notification", "render_navigation", "render_eye",
+  "flush"
+};
+
+static StageHistogram histograms[PROFILE_STAGE_COUNT];
+static unsigned long lastDump = 0;
+
+static void resetHistograms() {
+  memset(histograms, 0, sizeof(histograms));
+  for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+    histograms[i].minNs = UINT32_MAX;
+  }
+}
+
+static int bucketFor(uint32_t ns) {
+  if (ns < (1UL << PROFILE_MIN_OCTAVE)) {
+    return 0;
+  }
+  int octave = 31 - __builtin_clz(ns);
+  int sub = (ns >> (octave - 2)) & 3;
+  int bucket = (octave - PROFILE_MIN_OCTAVE) * 4 + sub + 1;
+  return bucket < PROFILE_BUCKETS ? bucket : PROFILE_BUCKETS - 1;
+}
+
+// Largest value a bucket can hold
+static uint32_t bucketCeiling(int bucket) {
+  if (bucket == 0) {
+    return (1UL << PROFILE_MIN_OCTAVE) - 1;
+  }
+  int octave = (bucket - 1) / 4 + PROFILE_MIN_OCTAVE;
+  int sub = (bucket - 1) % 4;
+  uint64_t ceiling = ((uint64_t)(5 + sub) << (octave - 2)) - 1;
+  return ceiling > UINT32_MAX ? UINT32_MAX : (uint32_t)ceiling;
+}
+
+static uint32_t percentile(const StageHistogram& h, uint32_t permille) {
+  uint32_t rank = (h.count * permille + 999) / 1000; // 1-based, rounded up
+  uint32_t seen = 0;
+  for (int i = 0; i < PROFILE_BUCKETS; i++) {
+    seen += h.buckets[i];
+    if (seen >= rank) {
+      uint32_t value = bucketCeiling(i);
+      if (value > h.maxNs) value = h.maxNs;
+      if (value < h.minNs) value = h.minNs;
+      return value;
+    }
+  }
+  return h.maxNs;
+}
+
+void initProfiler() {
+  Serial.begin(SERIAL_BAUD);
+  resetHistograms();
+  lastDump = millis();
+  Serial.println("prof,stage,count,min_ns,p50_ns,p99_ns,max_ns");
+}
+
+void profileRecord(ProfileStage stage, uint32_t startCycles) {
+  uint32_t cycles = ESP.getCycleCount() - startCycles;
+  uint32_t mhz = getCpuFrequencyMhz();
+  uint64_t ns64 = (uint64_t)cycles * 1000ULL / (mhz ? mhz : 1);
+  uint32_t ns = ns64 > UINT32_MAX ? UINT32_MAX : (uint32_t)ns64;
+
+  StageHistogram& h = histograms[stage];
+  h.count++;
+  if (ns < h.minNs) h.minNs = ns;
+  if (ns > h.maxNs) h.maxNs = ns;
+  uint16_t& bucket = h.buckets[bucketFor(ns)];
+  if (bucket != UINT16_MAX) bucket++;
+}
+
+void profileDump(unsigned long now) {
+  if (now - lastDump < PROFILE_DUMP_INTERVAL) {
+    return;
+  }
+  lastDump = now;
+  for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+    const StageHistogram& h = histograms[i];
+    if (h.count == 0) continue;
+    Serial.printf("prof,%s,%lu,%lu,%lu,%lu,%lu\n", stageNames[i],
+                  (unsigned long)h.count, (unsigned long)h.minNs,
+                  (unsigned long)percentile(h, 500), (unsigned long)percentile(h, 990),
+                  (unsigned long)h.maxNs);
+  }
+  resetHistograms();
+}
+
+#endif // PROFILE_STAGES
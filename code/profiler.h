@@ -0,0 +1,51 @@
+/*
+ * Profiler - Optional per-stage cycle timing with histograms over Serial
+ *
+ * Build with PROFILE_STAGES=1 to enable. When it is 0 (the default) every
+ * PROFILE_* macro expands to nothing and no profiler state is linked in.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Timed stages; the face renders follow DisplayMode order
+enum ProfileStage {
+  PROFILE_LOOP,        // One loop() iteration, excluding the idle wait
+  PROFILE_CHRONOS,     // chronos.loop()
+  PROFILE_EVENTS,      // processBleEvents() (notification/nav/weather changes)
+  PROFILE_MODE_LOGIC,  // updateDisplay() mode selection up to the redraw decision
+  PROFILE_RENDER_TIME,
+  PROFILE_RENDER_WEATHER,
+  PROFILE_RENDER_FORECAST,
+  PROFILE_RENDER_NOTIFICATION,
+  PROFILE_RENDER_NAVIGATION,
+  PROFILE_RENDER_EYE,
+  PROFILE_FLUSH,       // flushDisplay()
+  PROFILE_STAGE_COUNT
+};
+
+#if PROFILE_STAGES
+
+// Function declarations
+void initProfiler();
+void profileRecord(ProfileStage stage, uint32_t startCycles);
+void profileDump(unsigned long now); // Prints and resets every PROFILE_DUMP_INTERVAL
+
+#define PROFILE_INIT() initProfiler()
+#define PROFILE_BEGIN(name) uint32_t profileStart_##name = ESP.getCycleCount()
+#define PROFILE_END(name, stage) profileRecord((ProfileStage)(stage), profileStart_##name)
+#define PROFILE_DUMP(now) profileDump(now)
+
+#else
+
+#define PROFILE_INIT() do {} while (0)
+#define PROFILE_BEGIN(name) do {} while (0)
+#define PROFILE_END(name, stage) do {} while (0)
+#define PROFILE_DUMP(now) do {} while (0)
+
+#endif // PROFILE_STAGES
+
+#endif // PROFILER_H
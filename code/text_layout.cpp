@@ -0,0 +1,222 @@
+/*
+ * Text Layout - Heap-free word wrapping and drawing in the bitmap fonts
+ *
+ * Works on plain char buffers and returns line tables of (start, length)
+ * spans, so faces can wrap and truncate arbitrary messages without creating
+ * String temporaries on every redraw. Lines are filled by the exact pixel
+ * width of the proportional font, not a fixed 6px per character.
+ */
+
+#include "text_layout.h"
+#include <string.h>
+
+// ASCII stand-ins for U+00C0..U+00FF (Latin-1 letters); the fonts are ASCII only
+static const char latin1Fold[] =
+  "AAAAAAACEEEEIIII" "DNOOOOOxOUUUUYPs"
+  "aaaaaaaceeeeiiii" "dnooooo/ouuuuypy";
+
+// Decode one UTF-8 sequence at p into an ASCII replacement. Returns the
+// number of source bytes consumed and points *out at the replacement
+// ("" = drop the character). single is scratch space for one folded letter.
+static int foldUtf8(const char* p, const char** out, char single[2]) {
+  unsigned char c = (unsigned char)p[0];
+  int length = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC0) ? 2 : 1;
+  uint32_t code = (length == 4) ? (c & 0x07) : (length == 3) ? (c & 0x0F) : (length == 2) ? (c & 0x1F) : 0;
+  for (int i = 1; i < length; i++) {
+    unsigned char next = (unsigned char)p[i];
+    if ((next & 0xC0) != 0x80) {
+      *out = "?"; // Truncated sequence
+      return i;
+    }
+    code = (code << 6) | (next & 0x3F);
+  }
+  if (length == 1) {
+    *out = "?"; // Stray continuation byte
+    return 1;
+  }
+
+  switch (code) {
+    case 0x00A0: *out = " "; break;           // No-break space
+    case 0x2018: case 0x2019: *out = "'"; break;
+    case 0x201C: case 0x201D: *out = "\""; break;
+    case 0x2013: case 0x2014: *out = "-"; break;
+    case 0x2022: *out = "*"; break;
+    case 0x2026: *out = "..."; break;
+    case 0x200B: case 0xFE0F: *out = ""; break; // Zero-width space, emoji variation selector
+    default:
+      if (code >= 0xC0 && code <= 0xFF) {
+        single[0] = latin1Fold[code - 0xC0];
+        single[1] = '\0';
+        *out = single;
+      } else {
+        *out = "?";
+      }
+      break;
+  }
+  return length;
+}
+
+size_t normalizeText(char* dst, size_t dstSize, const char* src, bool* truncated) {
+  if (truncated) *truncated = false;
+  if (dstSize == 0) return 0;
+  size_t length = 0;
+  bool pendingSpace = false;
+  const char* p = src;
+  const char* piece = "";
+  char ascii[2];
+  while (*p && length < dstSize - 1) {
+    ascii[0] = *p;
+    ascii[1] = '\0';
+    if ((unsigned char)*p >= 0x80) {
+      p += foldUtf8(p, &piece, ascii);
+    } else {
+      piece = ascii;
+      p++;
+    }
+
+    for (; *piece && length < dstSize - 1; piece++) {
+      char c = *piece;
+      if ((unsigned char)c <= ' ') {
+        pendingSpace = length > 0; // Drop leading whitespace
+        continue;
+      }
+      if (pendingSpace) {
+        dst[length++] = ' ';
+        pendingSpace = false;
+        if (length >= dstSize - 1) break;
+      }
+      dst[length++] = c;
+    }
+  }
+  // Trailing whitespace is never emitted, but a cut at the buffer end can
+  // leave a single space behind
+  if (length > 0 && dst[length - 1] == ' ') length--;
+  dst[length] = '\0';
+
+  // Anything visible left in the current piece or the source was cut off
+  if (truncated) {
+    for (const char* q = piece; *q && !*truncated; q++) *truncated = (unsigned char)*q > ' ';
+    for (const char* q = p; *q && !*truncated; q++) *truncated = (unsigned char)*q > ' ';
+  }
+  return length;
+}
+
+size_t replaceText(char* text, size_t size, const char* find, const char* replacement) {
+  size_t length = strlen(text);
+  size_t findLength = strlen(find);
+  size_t replacementLength = strlen(replacement);
+  if (findLength == 0) return length;
+
+  char* match = strstr(text, find);
+  while (match) {
+    size_t offset = match - text;
+    size_t tail = length - offset - findLength;
+    size_t newLength = length - findLength + replacementLength;
+    if (newLength > size - 1) break; // No room to grow
+    memmove(match + replacementLength, match + findLength, tail + 1);
+    memcpy(match, replacement, replacementLength);
+    length = newLength;
+    match = strstr(match + replacementLength, find);
+  }
+  return length;
+}
+
+// Last space in text[from..to] that leaves the line more than half full
+static int findBreak(const Font& font, const char* text, int from, int to, int maxWidth) {
+  for (int i = to; i > from; i--) {
+    if (text[i] == ' ') {
+      return (fontTextWidth(font, text + from, i - from) > maxWidth / 2) ? i : -1;
+    }
+  }
+  return -1;
+}
+
+// Characters of the line at start that still fit next to "...", broken at
+// a word when possible
+static int fitEllipsis(const Font& font, const char* text, int start, int take, int maxWidth) {
+  int available = maxWidth - fontTextWidth(font, "...", 3) - font.spacing;
+  int fit = fontFitLength(font, text + start, take, available);
+  if (take > fit) {
+    int brk = findBreak(font, text, start, start + fit, available);
+    take = (brk > 0) ? brk - start : fit;
+  }
+  return take;
+}
+
+void layoutText(const char* text, int maxWidth, int maxLines, TextLayout& layout,
+                bool ellipsis, const Font& font) {
+  layout.count = 0;
+  layout.truncated = false;
+  if (maxLines > TEXT_LAYOUT_MAX_LINES) maxLines = TEXT_LAYOUT_MAX_LINES;
+
+  int length = strlen(text);
+  int pos = 0;
+
+  while (layout.count < maxLines) {
+    while (pos < length && text[pos] == ' ') pos++;
+    if (pos >= length) break;
+
+    int start = pos;
+    int take = fontFitLength(font, text + start, min(length - start, 255), maxWidth);
+    if (take < 1) take = 1;
+    if (take < length - start) {
+      // Prefer a word boundary (a space right after the last fitting
+      // character counts), otherwise hard-break long words
+      int brk = findBreak(font, text, start, start + take, maxWidth);
+      take = (brk > 0) ? brk - start : take;
+    }
+    pos = start + take;
+
+    bool lastLine = (layout.count == maxLines - 1);
+    bool more = false;
+    for (int i = pos; i < length; i++) {
+      if (text[i] != ' ') {
+        more = true;
+        break;
+      }
+    }
+    if (lastLine && more) {
+      layout.truncated = true;
+      if (ellipsis) {
+        take = fitEllipsis(font, text, start, take, maxWidth);
+      }
+    }
+
+    // Trim trailing spaces from the line
+    while (take > 0 && text[start + take - 1] == ' ') take--;
+
+    TextLine& line = layout.lines[layout.count++];
+    line.start = start;
+    line.length = take;
+    line.ellipsis = lastLine && more && ellipsis;
+    if (lastLine && more) break;
+  }
+}
+
+void truncateLayout(const char* text, int maxWidth, TextLayout& layout, const Font& font) {
+  layout.truncated = true;
+  if (layout.count == 0 || layout.lines[layout.count - 1].ellipsis) {
+    return;
+  }
+  TextLine& line = layout.lines[layout.count - 1];
+  int take = fitEllipsis(font, text, line.start, line.length, maxWidth);
+  while (take > 0 && text[line.start + take - 1] == ' ') take--;
+  line.length = take;
+  line.ellipsis = true;
+}
+
+int drawText(const char* text, int length, int x, int y, const Font& font, uint16_t color) {
+  return drawFontText(display.getBuffer(), font, x, y, text, length, color);
+}
+
+int drawText(const char* text, int x, int y, const Font& font, uint16_t color) {
+  return drawText(text, strlen(text), x, y, font, color);
+}
+
+void drawTextLine(const char* text, const TextLine& line, int x, int y, const Font& font) {
+  int next = drawText(text + line.start, line.length, x, y, font);
+  if (line.ellipsis) {
+    // Glyph spacing already follows the line, unless it is empty
+    drawText("...", 3, line.length > 0 ? next : x, y, font);
+  }
+}
@@ -0,0 +1,54 @@
+/*
+ * Text Layout - Heap-free word wrapping and drawing in the bitmap fonts
+ */
+
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include "config.h"
+#include "font.h"
+
+// Forward declarations
+extern Adafruit_SSD1306 display;
+
+// One laid-out line: a span into the caller's text buffer
+struct TextLine {
+  uint16_t start;  // Offset of the first character
+  uint8_t length;  // Characters on the line (excluding the ellipsis)
+  bool ellipsis;   // Draw "..." after the line
+};
+
+// Line table produced by layoutText()
+struct TextLayout {
+  TextLine lines[TEXT_LAYOUT_MAX_LINES];
+  uint8_t count;
+  bool truncated;  // Text did not fit in the requested lines
+};
+
+// Function declarations
+// Copy src into dst, folding UTF-8 to what the classic font can show (Latin-1
+// letters to their base letter, typographic punctuation to ASCII, anything
+// else to '?'), turning control characters into spaces, collapsing runs of
+// whitespace and trimming both ends. Returns the resulting length; sets
+// *truncated when visible text did not fit in dst.
+size_t normalizeText(char* dst, size_t dstSize, const char* src, bool* truncated = nullptr);
+// Replace every occurrence of find in place; stops growing at size - 1.
+// Returns the resulting length.
+size_t replaceText(char* text, size_t size, const char* find, const char* replacement);
+// Word-wrap text into at most maxLines lines of maxWidth pixels, measured
+// in font. With ellipsis set, the last line is shortened to make room for
+// "..." when the text does not fit.
+void layoutText(const char* text, int maxWidth, int maxLines, TextLayout& layout,
+                bool ellipsis = true, const Font& font = fontSmall);
+// Mark a layout of text that was itself cut short: the last line gets "..."
+// even though everything left fitted
+void truncateLayout(const char* text, int maxWidth, TextLayout& layout, const Font& font = fontSmall);
+// Blit into the display buffer; returns the x where the next glyph would start
+int drawText(const char* text, int length, int x, int y, const Font& font = fontSmall,
+             uint16_t color = SSD1306_WHITE);
+int drawText(const char* text, int x, int y, const Font& font = fontSmall, uint16_t color = SSD1306_WHITE);
+void drawTextLine(const char* text, const TextLine& line, int x, int y, const Font& font = fontSmall);
+
+#endif // TEXT_LAYOUT_H
@@ -1,72 +1,200 @@
 /*
  * Weather Cache - Manages local weather data caching for offline operation
+ *
+ * Keeps today's weather, the forecast and the city in one fixed-layout
+ * CachedWeather image that is also persisted to NVS, so the weather and
+ * forecast faces have something to show right after a reboot, before the
+ * phone reconnects.
+ *
+ * Flash wear: the image is only written when its contents really changed
+ * (or the stored timestamp is getting old), after the burst of weather,
+ * forecast and location packets has settled (WEATHER_CACHE_SETTLE) and at
+ * most once per WEATHER_CACHE_WRITE_INTERVAL.
  */
 
 #include "weather_cache.h"
 #include "config.h"
+#include <ESP32Time.h>
+#include <Preferences.h>
+#include <stddef.h>
+#include <string.h>
 
 // Forward declaration
 extern ChronosESP32 chronos;
+extern ESP32Time rtc;
+extern bool weatherChanged;
 
 // Weather cache
 CachedWeather cachedWeather;
 
+static unsigned long cachedAt = 0;     // millis() the data arrived (back-dated when loaded)
+static bool cacheExpired = true;       // Known to be older than CACHE_MAX_AGE
+static bool cacheDirty = false;        // RAM image differs from NVS
+static unsigned long lastChange = 0;
+static unsigned long lastWrite = 0;
+static bool written = false;          // NVS holds an image (loaded or written)
+static bool writtenThisBoot = false;  // Rate limit only applies after our own write
+static bool cacheUnverified = false;  // Loaded with the clock behind its stamp: age unknown
+static uint32_t storedEpoch = 0;       // Timestamp of the image in NVS
+
+static const char* const cacheNamespace = "weather";
+static const char* const cacheKey = "cache";
+
+static int8_t clampInt8(int value) {
+  return value < -128 ? -128 : (value > 127 ? 127 : value);
+}
+
+static void packDay(CachedDay& day, const Weather& weather) {
+  day.temp = clampInt8(weather.temp);
+  day.high = clampInt8(weather.high);
+  day.low = clampInt8(weather.low);
+  day.icon = weather.icon;
+  day.day = weather.day;
+  day.uv = weather.uv;
+  day.pressure = weather.pressure < 0 ? 0 : (weather.pressure > 0xFFFF ? 0xFFFF : weather.pressure);
+}
+
+// Everything but the timestamp; images are memset so padding compares equal
+static bool sameContent(const CachedWeather& a, const CachedWeather& b) {
+  return memcmp(&a, &b, offsetof(CachedWeather, epoch)) == 0;
+}
+
+// Un-expire loaded data once its real age is known. System time survives
+// software and watchdog resets, so this usually succeeds at boot; after a
+// power cycle the clock restarts behind the stored stamp and the data stays
+// hidden until the phone sets the time.
+static void verifyCacheAge() {
+  unsigned long epoch = rtc.getEpoch();
+  if (epoch < storedEpoch) {
+    return;
+  }
+  cacheUnverified = false;
+  unsigned long ageSeconds = epoch - storedEpoch;
+  if (ageSeconds >= CACHE_MAX_AGE / 1000) {
+    return;
+  }
+  cachedAt = millis() - ageSeconds * 1000;
+  cacheExpired = false;
+  weatherChanged = true; // Let the device state pick the cached days up
+}
+
+static void loadWeatherCache() {
+#if WEATHER_CACHE_PERSIST
+  Preferences prefs;
+  if (!prefs.begin(cacheNamespace, true)) {
+    return;
+  }
+  CachedWeather stored;
+  bool ok = prefs.getBytesLength(cacheKey) == sizeof(stored) &&
+            prefs.getBytes(cacheKey, &stored, sizeof(stored)) == sizeof(stored);
+  prefs.end();
+  if (!ok || stored.version != WEATHER_CACHE_VERSION || stored.count == 0 ||
+      stored.count > WEATHER_CACHE_DAYS) {
+    return;
+  }
+  stored.city[WEATHER_CITY_MAX - 1] = '\0';
+  cachedWeather = stored;
+  storedEpoch = stored.epoch;
+  written = true;
+  cacheUnverified = true;
+  verifyCacheAge();
+#endif
+}
+
 void initWeatherCache() {
-  cachedWeather.valid = false;
-  cachedWeather.temp = 0;
-  cachedWeather.high = 0;
-  cachedWeather.low = 0;
-  cachedWeather.icon = 0;
-  cachedWeather.city = "";
-  cachedWeather.timestamp = 0;
+  memset(&cachedWeather, 0, sizeof(cachedWeather));
+  cachedWeather.version = WEATHER_CACHE_VERSION;
+  cacheExpired = true;
+  cacheDirty = false;
+  written = false;
+  writtenThisBoot = false;
+  cacheUnverified = false;
+  storedEpoch = 0;
+  loadWeatherCache();
 }
 
 void updateWeatherCache() {
-  if (chronos.getWeatherCount() > 0) {
-    Weather weather = chronos.getWeatherAt(0);
-    WeatherLocation location = chronos.getWeatherLocation();
-    
-    cachedWeather.valid = true;
-    cachedWeather.temp = weather.temp;
-    cachedWeather.high = weather.high;
-    cachedWeather.low = weather.low;
-    cachedWeather.icon = weather.icon;
-    // Only store city if location.city is available, otherwise use getWeatherCity()
-    String citySource = location.city;
-    cachedWeather.city = citySource.length() > 0 ? citySource : chronos.getWeatherCity();
-    cachedWeather.timestamp = millis();
+  int count = chronos.getWeatherCount();
+  if (count <= 0) {
+    return;
+  }
+
+  CachedWeather next;
+  memset(&next, 0, sizeof(next));
+  next.version = WEATHER_CACHE_VERSION;
+  next.count = min(count, WEATHER_CACHE_DAYS);
+  for (int i = 0; i < next.count; i++) {
+    packDay(next.days[i], chronos.getWeatherAt(i));
+  }
+  // Only store city if location.city is available, otherwise use getWeatherCity()
+  WeatherLocation location = chronos.getWeatherLocation();
+  const String& city = location.city.length() > 0 ? location.city : chronos.getWeatherCity();
+  strncpy(next.city, city.c_str(), WEATHER_CITY_MAX - 1);
+  next.epoch = rtc.getEpoch();
+
+  unsigned long now = millis();
+  // Same data again only refreshes the stored stamp once it is half expired.
+  // Before the phone sets the clock (cold boot) the age is unknown, and a
+  // clock behind the stored stamp must not wrap into a huge age
+  bool clockValid = next.epoch >= CLOCK_VALID_EPOCH;
+  bool stale = clockValid && next.epoch > storedEpoch && next.epoch - storedEpoch >= CACHE_MAX_AGE / 2000;
+  if (!sameContent(next, cachedWeather) || (written && stale)) {
+    cacheDirty = true;
+    lastChange = now;
   }
+  cachedWeather = next;
+  cachedAt = now;
+  cacheExpired = false;
+  cacheUnverified = false;
 }
 
-bool hasWeatherData() {
-  // Check if current data is available
-  if (chronos.getWeatherCount() > 0) {
-    return true;
+void pollWeatherCache(unsigned long now) {
+#if WEATHER_CACHE_PERSIST
+  if (!cacheDirty || now - lastChange < WEATHER_CACHE_SETTLE ||
+      (writtenThisBoot && now - lastWrite < WEATHER_CACHE_WRITE_INTERVAL)) {
+    return;
   }
-  
-  // Check if cached data is available and not too old
-  if (cachedWeather.valid) {
-    unsigned long age = millis() - cachedWeather.timestamp;
-    if (age < CACHE_MAX_AGE) {
-      return true;
-    }
+  cacheDirty = false;
+  lastWrite = now;
+  written = true;
+  writtenThisBoot = true;
+  storedEpoch = cachedWeather.epoch;
+
+  Preferences prefs;
+  if (prefs.begin(cacheNamespace, false)) {
+    prefs.putBytes(cacheKey, &cachedWeather, sizeof(cachedWeather));
+    prefs.end();
   }
-  
-  return false;
+#else
+  (void)now;
+#endif
 }
 
-bool getCachedWeather(Weather& weather, String& city) {
-  if (cachedWeather.valid) {
-    unsigned long age = millis() - cachedWeather.timestamp;
-    if (age < CACHE_MAX_AGE) {
-      weather.temp = cachedWeather.temp;
-      weather.high = cachedWeather.high;
-      weather.low = cachedWeather.low;
-      weather.icon = cachedWeather.icon;
-      city = cachedWeather.city;
-      return true;
-    }
+bool weatherCacheFresh() {
+  if (cacheUnverified) {
+    verifyCacheAge(); // Until the phone has set the clock
+  }
+  if (cacheExpired || cachedWeather.count == 0) {
+    return false;
   }
-  return false;
+  if (millis() - cachedAt >= CACHE_MAX_AGE) {
+    cacheExpired = true; // Sticky, so millis() wraparound cannot revive it
+    return false;
+  }
+  return true;
 }
 
+bool getCachedDay(int index, Weather& weather) {
+  if (index < 0 || index >= cachedWeather.count) {
+    return false;
+  }
+  const CachedDay& day = cachedWeather.days[index];
+  weather.icon = day.icon;
+  weather.day = day.day;
+  weather.temp = day.temp;
+  weather.high = day.high;
+  weather.low = day.low;
+  weather.pressure = day.pressure;
+  weather.uv = day.uv;
+  return true;
+}
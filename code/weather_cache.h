@@ -9,15 +9,27 @@
 #include <ChronosESP32.h>
 #include "config.h"
 
-// Cached weather data structure
+#define WEATHER_CACHE_VERSION 1 // Bump when the CachedWeather layout changes
+#define WEATHER_CACHE_DAYS (WEATHER_FORECAST_MAX + 1) // Today plus the forecast
+
+// One day as the faces show it, packed to 8 bytes
+struct CachedDay {
+  int8_t temp;
+  int8_t high;
+  int8_t low;
+  uint8_t icon;
+  uint8_t day;
+  uint8_t uv;
+  uint16_t pressure;
+};
+
+// Fixed-layout cache image, stored in NVS as a single blob
 struct CachedWeather {
-  bool valid;
-  int temp;
-  int high;
-  int low;
-  int icon;
-  String city;
-  unsigned long timestamp; // When data was cached
+  uint8_t version;
+  uint8_t count;                       // Valid entries in days[], 0 = empty
+  CachedDay days[WEATHER_CACHE_DAYS];  // days[0] is today
+  char city[WEATHER_CITY_MAX];
+  uint32_t epoch;                      // RTC time the phone sent it (not compared)
 };
 
 // External cache
@@ -26,8 +38,8 @@ extern CachedWeather cachedWeather;
 // Function declarations
 void initWeatherCache();
 void updateWeatherCache();
-bool hasWeatherData();
-bool getCachedWeather(Weather& weather, String& city);
+void pollWeatherCache(unsigned long now);
+bool weatherCacheFresh();
+bool getCachedDay(int index, Weather& weather);
 
 #endif // WEATHER_CACHE_H
-
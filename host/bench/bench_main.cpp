@@ -0,0 +1,399 @@
+/*
+ * Host Benchmarks - Per-frame cost of face renderers and data paths
+ *
+ * Runs each renderer and the notification/weather paths many times with
+ * representative data and reports wall-clock ns per operation plus heap
+ * allocations and bytes allocated per operation (global operator new is
+ * instrumented). Output is one "bench=..." line per case.
+ *
+ * Usage: infoview_bench [--iters N] [--filter substring]
+ */
+
+#include <Arduino.h>
+#include <Adafruit_SSD1306.h>
+#include <ChronosESP32.h>
+#include <ESP32Time.h>
+#include <chrono>
+#include <new>
+
+#include "config.h"
+#include "display_manager.h"
+#include "display_time.h"
+#include "display_flush.h"
+#include "display_weather.h"
+#include "display_forecast.h"
+#include "display_notification.h"
+#include "display_navigation.h"
+#include "nav_classifier.h"
+#include "nav_icon_cache.h"
+#include "nav_icons.h"
+#include "nav_icon_pages.h"
+#include "page_bitmap.h"
+#include "framebuffer.h"
+#include "font.h"
+#include "display_eye.h"
+#include "notification_queue.h"
+#include "ble_handler.h"
+#include "event_queue.h"
+#include "weather_cache.h"
+#include "device_state.h"
+#include "host_clock.h"
+#include "host_panel.h"
+
+// Globals normally defined in code.ino
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+ChronosESP32 chronos(DEVICE_NAME);
+ESP32Time rtc;
+
+// --- Allocation accounting ---
+
+static unsigned long allocCount = 0;
+static unsigned long allocBytes = 0;
+
+void* operator new(size_t size) {
+  allocCount++;
+  allocBytes += size;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void* operator new[](size_t size) {
+  allocCount++;
+  allocBytes += size;
+  void* p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// --- Harness ---
+
+static unsigned long iterations = 2000;
+static const char* filter = NULL;
+
+typedef void (*BenchFn)(unsigned long i);
+
+static void runBench(const char* name, BenchFn setup, BenchFn body) {
+  if (filter && !strstr(name, filter)) return;
+  if (setup) setup(0);
+  body(0); // Warm-up: first-call caches and lazy state
+
+  unsigned long startAllocs = allocCount;
+  unsigned long startBytes = allocBytes;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned long i = 0; i < iterations; i++) {
+    body(i);
+  }
+  auto elapsed = std::chrono::steady_clock::now() - start;
+
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / iterations;
+  double allocs = (double)(allocCount - startAllocs) / iterations;
+  double bytes = (double)(allocBytes - startBytes) / iterations;
+  printf("bench=%-32s iters=%lu ns_per_op=%.0f allocs_per_op=%.2f bytes_per_op=%.1f\n",
+         name, iterations, ns, allocs, bytes);
+}
+
+// Snapshot the tick's state and prepare the framebuffer the way loop() and
+// updateDisplay() do before a face renders
+static void beginFrame() {
+  updateDeviceState();
+  display.clearDisplay();
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE);
+}
+
+// --- Representative data ---
+
+static const char* longCity = "Special Region of Yogyakarta, Indonesia";
+
+static const char* longMessage =
+  "Are we still on for dinner tonight? I booked the table for seven at the place "
+  "near the station, the one with the  rooftop  garden. Let me know if that works "
+  "or if we should move it to Friday instead, thanks!";
+
+static const char* navDirections[] = {
+  "Continue straight on Jalan Sudirman",
+  "Turn left onto Jalan Malioboro",
+  "Turn right onto Jalan Solo",
+  "Turn slight left toward the ring road",
+  "Bear right onto the highway",
+  "Make a sharp left",
+  "Hard right at the end of the road",
+  "Make a U-turn",
+  "At the roundabout take the 1st exit",
+  "At the roundabout take the 2nd exit",
+  "At the traffic circle take the third exit",
+  "At the fork keep left",
+  "At the fork keep right",
+  "Take the ramp on the left",
+  "Take the slip road on the right",
+  "Merge onto the motorway",
+  "Keep left to stay on the highway",
+  "Keep right at the junction",
+  "You have arrived at your destination",
+};
+static const int navDirectionCount = sizeof(navDirections) / sizeof(navDirections[0]);
+
+static const Weather forecast[] = {
+  {1, 0, 23, 27, 18, 1012, 5},
+  {3, 1, 20, 22, 15, 1010, 3},
+  {5, 2, 19, 21, 14, 1008, 2},
+  {0, 3, 25, 29, 19, 1014, 7},
+  {7, 4, 17, 19, 12, 1016, 1},
+};
+
+static Notification makeNotification(unsigned long i) {
+  Notification n;
+  n.icon = 0;
+  n.time = "12:00";
+  n.app = (i & 1) ? "WhatsApp" : "Telegram";
+  n.title = "Budi Santoso";
+  n.message = longMessage;
+  return n;
+}
+
+static void setNavigation(const char* directions) {
+  Navigation nav = chronos.getNavigation();
+  nav.active = true;
+  nav.isNavigation = true;
+  nav.hasIcon = false;
+  nav.title = "350 m";
+  nav.duration = "12 mins";
+  nav.directions = directions;
+  chronos.hostSetNavigation(nav);
+  navigationChanged = true; // As processBleEvents() would
+}
+
+// --- Cases ---
+
+static void setupWeather(unsigned long) {
+  chronos.hostSetConnected(true);
+  chronos.hostSetBattery(72);
+  chronos.hostSetWeather(forecast, 5, longCity);
+  updateWeatherCache();
+  weatherChanged = true;
+}
+
+static void benchTime(unsigned long) {
+  hostAdvanceMillis(1000);
+  beginFrame();
+  displayTime();
+}
+
+static void setupTimeUpdate(unsigned long) {
+  beginFrame();
+  displayTime();
+  flushDisplay();
+}
+
+// Next second through the region path, full render only when it declines
+static bool nextTimeFrame(DisplayRegion& dirty) {
+  hostAdvanceMillis(1000);
+  updateDeviceState();
+  if (updateTime(dirty)) {
+    return true;
+  }
+  display.clearDisplay();
+  displayTime();
+  return false;
+}
+
+static void benchTimeUpdate(unsigned long) {
+  DisplayRegion dirty;
+  nextTimeFrame(dirty);
+}
+
+static void benchTimeFlush(unsigned long) {
+  // Whole frame every second: render, hash, diff and snapshot
+  benchTime(0);
+  flushDisplay();
+}
+
+static void benchTimeRegionFlush(unsigned long) {
+  DisplayRegion dirty;
+  if (nextTimeFrame(dirty)) {
+    flushDisplayRegion(dirty);
+  } else {
+    flushDisplay();
+  }
+}
+
+static void benchWeather(unsigned long) {
+  hostAdvanceMillis(SCROLL_INTERVAL); // Keep the city header scrolling
+  beginFrame();
+  displayWeather();
+}
+
+static void benchForecast(unsigned long) {
+  beginFrame();
+  displayForecast();
+}
+
+static void benchEye(unsigned long) {
+  hostAdvanceMillis(17); // Past the eye's 16ms physics gate
+  beginFrame();
+  displayEye();
+}
+
+static void setupNotification(unsigned long) {
+  initNotificationQueue();
+  for (int i = 0; i < MAX_NOTIFICATIONS; i++) addNotification(makeNotification(i));
+}
+
+static void benchNotification(unsigned long) {
+  beginFrame();
+  displayNotification();
+}
+
+static void benchNavigation(unsigned long i) {
+  // Direction changes every 8 frames, like a real route progressing
+  if ((i & 7) == 0) setNavigation(navDirections[(i >> 3) % navDirectionCount]);
+  hostAdvanceMillis(500);
+  beginFrame();
+  displayNavigation();
+}
+
+static void benchMatchDirection(unsigned long i) {
+  // Uncached keyword scan, as on every new instruction
+  matchDirection(navDirections[i % navDirectionCount]);
+}
+
+static void benchClassifyDirection(unsigned long i) {
+  // Redraws of the current instruction: memo hits
+  classifyDirection(navDirections[(i >> 3) % navDirectionCount]);
+}
+
+static void benchDrawBitmap(unsigned long i) {
+  // Row-major icon through Adafruit_GFX, as icons used to be drawn
+  display.drawBitmap(9, 14 + (i & 7), nav_round_left_bits, ICON_W, ICON_H, SSD1306_WHITE);
+}
+
+static void benchDrawPageBitmap(unsigned long i) {
+  // Same icon in page layout; 1 of 8 offsets is page-aligned
+  drawPageBitmap(display.getBuffer(), 9, 14 + (i & 7), navIconPages[NAV_ROUND_LEFT], ICON_W, ICON_H);
+}
+
+static void benchFillRect(unsigned long i) {
+  // Weather header and bottom bars plus a separator, through Adafruit_GFX
+  display.fillRect(0, 0, SCREEN_WIDTH, 10, SSD1306_WHITE);
+  display.fillRect(0, 55, SCREEN_WIDTH, 9, SSD1306_WHITE);
+  display.drawLine(51, 0, 51, SCREEN_HEIGHT - 1, (i & 1) ? SSD1306_WHITE : SSD1306_BLACK);
+}
+
+static void benchFbFillRect(unsigned long i) {
+  // Same shapes with the byte-wise primitives
+  fbFillRect(display.getBuffer(), 0, 0, SCREEN_WIDTH, 10, SSD1306_WHITE);
+  fbFillRect(display.getBuffer(), 0, 55, SCREEN_WIDTH, 9, SSD1306_WHITE);
+  fbVLine(display.getBuffer(), 51, 0, SCREEN_HEIGHT, (i & 1) ? SSD1306_WHITE : SSD1306_BLACK);
+}
+
+static const char benchLine[] = "Meeting moved to 3pm, room 4B";
+
+static void benchPrint(unsigned long i) {
+  // One notification line and the clock digits through the classic font
+  display.setTextSize(1);
+  display.setCursor(2, 14 + (i & 7));
+  display.print(benchLine);
+  display.setTextSize(2);
+  display.setCursor(16, 18);
+  display.print("12:34:56");
+}
+
+static void benchDrawFontText(unsigned long i) {
+  // Same text blitted from the page-layout fonts
+  drawFontText(display.getBuffer(), fontSmall, 2, 14 + (i & 7), benchLine, sizeof(benchLine) - 1);
+  drawFontText(display.getBuffer(), fontLarge, 17, 18, "12:34:56", 8);
+}
+
+static uint8_t phoneIcon[(NAV_PHONE_ICON_W * NAV_PHONE_ICON_W) / 8];
+
+static void benchStoreNavIcon(unsigned long i) {
+  // A new icon (and library CRC) every iteration: one downscale
+  phoneIcon[i % sizeof(phoneIcon)] ^= 0x5A;
+  storeNavIcon(phoneIcon, i + 1);
+}
+
+static Notification burst[2];
+
+static void setupAddNotification(unsigned long i) {
+  setupNotification(i);
+  burst[0] = makeNotification(0);
+  burst[1] = makeNotification(1);
+}
+
+static void benchAddNotification(unsigned long i) {
+  // Prebuilt inputs so only the queue's own work is measured
+  addNotification(burst[i & 1]);
+}
+
+static void benchBleHandoff(unsigned long i) {
+  // BLE-side callback plus the loop-side drain, as in one tick
+  onNotification(burst[i & 1]);
+  processBleEvents();
+}
+
+static void benchProcessQueue(unsigned long i) {
+  if (notificationQueueCount == 0) {
+    for (int n = 0; n < MAX_NOTIFICATIONS; n++) addNotification(burst[(i + n) & 1]);
+  }
+  hostAdvanceMillis(NOTIFICATION_DISPLAY_TIME);
+  processNotificationQueue(millis(), false);
+}
+
+static void benchUpdateWeatherCache(unsigned long) {
+  updateWeatherCache();
+}
+
+static void benchUpdateDeviceState(unsigned long i) {
+  // A new second every tick, a weather refresh every 64 ticks
+  hostAdvanceMillis(1000);
+  if ((i & 63) == 0) weatherChanged = true;
+  updateDeviceState();
+}
+
+int main(int argc, char** argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--iters") == 0 && i + 1 < argc) iterations = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc) filter = argv[++i];
+  }
+  if (iterations == 0) iterations = 1;
+
+  hostPanelSetBlockingBus(false);
+  display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS);
+  initDisplayManager();
+  initNotificationQueue();
+  initEventQueue();
+  initWeatherCache();
+  initDeviceState();
+  setupWeather(0);
+
+  runBench("face/time", NULL, benchTime);
+  runBench("face/timeUpdate", setupTimeUpdate, benchTimeUpdate);
+  runBench("flush/time", setupTimeUpdate, benchTimeFlush);
+  runBench("flush/timeRegion", setupTimeUpdate, benchTimeRegionFlush);
+  runBench("face/weather", setupWeather, benchWeather);
+  runBench("face/forecast", setupWeather, benchForecast);
+  runBench("face/eye", NULL, benchEye);
+  runBench("face/notification", setupNotification, benchNotification);
+  runBench("face/navigation", NULL, benchNavigation);
+  runBench("gfx/drawBitmap", NULL, benchDrawBitmap);
+  runBench("gfx/drawPageBitmap", NULL, benchDrawPageBitmap);
+  runBench("gfx/fillRect", NULL, benchFillRect);
+  runBench("gfx/fbFillRect", NULL, benchFbFillRect);
+  runBench("gfx/print", NULL, benchPrint);
+  runBench("gfx/drawFontText", NULL, benchDrawFontText);
+  runBench("nav/matchDirection", NULL, benchMatchDirection);
+  runBench("nav/classifyDirection", NULL, benchClassifyDirection);
+  runBench("nav/storeNavIcon", NULL, benchStoreNavIcon);
+  runBench("queue/addNotification", setupAddNotification, benchAddNotification);
+  runBench("queue/processNotificationQueue", setupAddNotification, benchProcessQueue);
+  runBench("queue/bleNotificationHandoff", setupAddNotification, benchBleHandoff);
+  runBench("weather/updateWeatherCache", setupWeather, benchUpdateWeatherCache);
+  runBench("state/updateDeviceState", setupWeather, benchUpdateDeviceState);
+  return 0;
+}
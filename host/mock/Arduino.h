@@ -0,0 +1,152 @@
+/*
+ * Host mock - Minimal Arduino core for off-device builds
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define F(s) (s)
+
+#define DEC 10
+#define HEX 16
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// Injectable clock (see host_clock.h)
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+uint32_t esp_random();
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getCpuFrequencyMhz();
+
+// Cycle counter: host wall time scaled to the nominal CPU clock
+class EspClass {
+public:
+  uint32_t getCycleCount();
+};
+
+extern EspClass ESP;
+
+class String {
+public:
+  String(const char* s = "");
+  String(const String& other);
+  String(String&& other) noexcept;
+  explicit String(char c);
+  String(int value, unsigned char base = 10);
+  String(unsigned int value, unsigned char base = 10);
+  String(long value, unsigned char base = 10);
+  String(unsigned long value, unsigned char base = 10);
+  ~String();
+
+  String& operator=(const String& other);
+  String& operator=(String&& other) noexcept;
+  String& operator=(const char* s);
+
+  unsigned int length() const { return len_; }
+  const char* c_str() const { return buf_ ? buf_ : ""; }
+  char charAt(unsigned int index) const;
+  char operator[](unsigned int index) const { return charAt(index); }
+
+  bool concat(const char* s, unsigned int n);
+  bool concat(const char* s) { return concat(s, strlen(s)); }
+  bool concat(const String& s) { return concat(s.c_str(), s.len_); }
+  bool concat(char c) { return concat(&c, 1); }
+  bool concat(int value) { return concat(String(value)); }
+  String& operator+=(const String& s) { concat(s); return *this; }
+  String& operator+=(const char* s) { concat(s); return *this; }
+  String& operator+=(char c) { concat(c); return *this; }
+  String& operator+=(int value) { concat(value); return *this; }
+
+  bool equals(const String& s) const { return strcmp(c_str(), s.c_str()) == 0; }
+  bool equals(const char* s) const { return strcmp(c_str(), s) == 0; }
+  bool operator==(const String& s) const { return equals(s); }
+  bool operator==(const char* s) const { return equals(s); }
+  bool operator!=(const String& s) const { return !equals(s); }
+  bool operator!=(const char* s) const { return !equals(s); }
+
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const char* s, unsigned int from = 0) const;
+  int indexOf(const String& s, unsigned int from = 0) const { return indexOf(s.c_str(), from); }
+  int lastIndexOf(char c) const;
+  int lastIndexOf(char c, unsigned int from) const;
+
+  String substring(unsigned int begin) const { return substring(begin, len_); }
+  String substring(unsigned int begin, unsigned int end) const;
+
+  void replace(const char* find, const char* replacement);
+  void replace(const String& find, const String& replacement) { replace(find.c_str(), replacement.c_str()); }
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  int toInt() const { return atoi(c_str()); }
+  bool reserve(unsigned int size);
+
+private:
+  char* buf_;
+  unsigned int len_;
+  unsigned int cap_;
+};
+
+String operator+(const String& a, const String& b);
+String operator+(const String& a, const char* b);
+String operator+(const char* a, const String& b);
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write((const uint8_t*)s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int n, int base = DEC) { return print((long)n, base); }
+  size_t print(unsigned int n, int base = DEC) { return print((unsigned long)n, base); }
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(double n, int digits = 2);
+
+  size_t println() { return write((const uint8_t*)"\r\n", 2); }
+  template <typename T> size_t println(const T& value) { size_t n = print(value); return n + println(); }
+  template <typename T> size_t println(const T& value, int fmt) { size_t n = print(value, fmt); return n + println(); }
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  int available();
+  int read();
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,118 @@
+/*
+ * Host mock - Scriptable ChronosESP32 for off-device builds
+ */
+
+#ifndef HOST_CHRONOSESP32_H
+#define HOST_CHRONOSESP32_H
+
+#include <Arduino.h>
+#include <ESP32Time.h>
+
+#define WEATHER_SIZE 7
+#define NAV_ICON_WIDTH 48
+#define NAV_ICON_DATA_SIZE ((NAV_ICON_WIDTH * NAV_ICON_WIDTH) / 8)
+
+struct Notification {
+  int icon;
+  String time;
+  String app;
+  String title;
+  String message;
+};
+
+struct Weather {
+  int icon;
+  int day;
+  int temp;
+  int high;
+  int low;
+  int pressure;
+  int uv;
+};
+
+struct WeatherLocation {
+  String city;
+  String region;
+};
+
+struct Navigation {
+  bool active;
+  bool isNavigation;
+  bool hasIcon;
+  String distance;
+  String duration;
+  String eta;
+  String title;
+  String directions;
+  uint8_t icon[NAV_ICON_DATA_SIZE];
+  uint32_t iconCRC;
+};
+
+enum Config {
+  CF_TIME = 0,
+  CF_RTW,
+  CF_HR24,
+  CF_LANG,
+  CF_RST,
+  CF_CAMERA,
+  CF_PBAT,
+  CF_APP,
+  CF_QR,
+  CF_NAV_DATA,
+  CF_NAV_ICON,
+  CF_CONTACT,
+  CF_WEATHER,
+  CF_FONT
+};
+
+class ChronosESP32 : public ESP32Time {
+public:
+  ChronosESP32(String name = "Chronos ESP32");
+
+  void begin() {}
+  void loop() { loops++; }
+  bool isConnected() { return connected_; }
+  void setNotifyBattery(bool notify) { (void)notify; }
+  void syncRequest() {}
+  int getPhoneBattery() { return battery_; }
+  int getHourC() { return getHour(hour24_); }
+  bool is24Hour() { return hour24_; }
+
+  void setConnectionCallback(void (*callback)(bool)) { connectionCallback_ = callback; }
+  void setNotificationCallback(void (*callback)(Notification)) { notificationCallback_ = callback; }
+  void setConfigurationCallback(void (*callback)(Config, uint32_t, uint32_t)) { configCallback_ = callback; }
+
+  int getWeatherCount() { return weatherCount_; }
+  Weather getWeatherAt(int index);
+  WeatherLocation getWeatherLocation() { return location_; }
+  String getWeatherCity() { return location_.city; }
+  Navigation getNavigation() { return navigation_; }
+
+  // --- Host scripting ---
+  void hostSetConnected(bool connected);
+  void hostSetBattery(int level);
+  void hostSetHour24(bool hour24) { hour24_ = hour24; }
+  void hostSetWeather(const Weather* entries, int count, const char* city);
+  void hostClearWeather() { weatherCount_ = 0; }
+  void hostSetNavigation(const Navigation& nav);
+  void hostNotify(const char* app, const char* title, const char* message);
+
+  // Library call counters (host instrumentation)
+  unsigned long loops = 0;
+  unsigned long weatherReads = 0;
+  unsigned long navigationReads = 0;
+
+private:
+  bool connected_ = false;
+  bool hour24_ = true;
+  int battery_ = 0;
+  Weather weather_[WEATHER_SIZE];
+  int weatherCount_ = 0;
+  WeatherLocation location_;
+  Navigation navigation_;
+  void (*connectionCallback_)(bool) = nullptr;
+  void (*notificationCallback_)(Notification) = nullptr;
+  void (*configCallback_)(Config, uint32_t, uint32_t) = nullptr;
+};
+
+#endif // HOST_CHRONOSESP32_H
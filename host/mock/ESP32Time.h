@@ -0,0 +1,35 @@
+/*
+ * Host mock - ESP32Time backed by the injectable host clock
+ */
+
+#ifndef HOST_ESP32TIME_H
+#define HOST_ESP32TIME_H
+
+#include <Arduino.h>
+#include <time.h>
+
+class ESP32Time {
+public:
+  ESP32Time(unsigned long offset = 0) : offset_(offset) {}
+
+  void setTime(unsigned long epoch = 1609459200, int ms = 0);
+  tm getTimeStruct();
+  unsigned long getEpoch();
+  unsigned long getMillis();
+  int getSecond() { return getTimeStruct().tm_sec; }
+  int getMinute() { return getTimeStruct().tm_min; }
+  int getHour(bool mode = false);
+  int getDay() { return getTimeStruct().tm_mday; }
+  int getDayofWeek() { return getTimeStruct().tm_wday; }
+  int getDayofYear() { return getTimeStruct().tm_yday; }
+  int getMonth() { return getTimeStruct().tm_mon; }
+  int getYear() { return getTimeStruct().tm_year + 1900; }
+
+  // Number of localtime conversions performed (host instrumentation)
+  static unsigned long conversions;
+
+private:
+  unsigned long offset_;
+};
+
+#endif // HOST_ESP32TIME_H
@@ -0,0 +1,37 @@
+/*
+ * Host mock - Preferences (NVS key/value storage) kept in process memory
+ *
+ * Contents survive setup() being run again (a simulated reboot), like NVS
+ * survives a reset on the device.
+ */
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <stddef.h>
+#include <string>
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false, const char* partitionLabel = NULL);
+  void end();
+
+  size_t putBytes(const char* key, const void* value, size_t len);
+  size_t getBytes(const char* key, void* buf, size_t maxLen);
+  size_t getBytesLength(const char* key);
+  bool remove(const char* key);
+  bool clear();
+
+  // Flash write counters (host instrumentation)
+  static unsigned long writes;
+  static unsigned long bytesWritten;
+
+private:
+  std::string key(const char* name) const;
+
+  std::string namespace_;
+  bool open_ = false;
+  bool readOnly_ = false;
+};
+
+#endif // HOST_PREFERENCES_H
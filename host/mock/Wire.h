@@ -0,0 +1,31 @@
+/*
+ * Host mock - I2C bus routed to an emulated SSD1306 panel
+ */
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire : public Print {
+public:
+  bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0);
+  void setClock(uint32_t frequency);
+  uint32_t getClock() const { return clock_; }
+  void beginTransmission(uint8_t address);
+  void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+  uint8_t endTransmission(bool sendStop = true);
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t* data, size_t size) override;
+  using Print::write;
+
+private:
+  uint32_t clock_ = 100000;
+  uint8_t address_ = 0;
+  uint8_t txBuffer_[128]; // Matches I2C_BUFFER_LENGTH on ESP32
+  size_t txLength_ = 0;
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,25 @@
+/*
+ * Host mock - Injectable clock and Serial input for off-device builds
+ */
+
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+#include <stdint.h>
+
+// Virtual time: millis()/micros() return this value and delay() advances it,
+// so scheduler and face timing are deterministic on the host.
+void hostSetMicros(uint64_t us);
+void hostAdvanceMicros(uint64_t us);
+void hostAdvanceMillis(unsigned long ms);
+uint64_t hostMicros();
+
+// Wall-clock epoch seen by ESP32Time at hostMicros() == 0
+void hostSetEpoch(unsigned long epoch);
+unsigned long hostEpoch();
+
+// Bytes returned by Serial.read(); output written to Serial goes to stdout
+void hostSerialInput(const char* text);
+void hostSerialMute(bool mute);
+
+#endif // HOST_CLOCK_H
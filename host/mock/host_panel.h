@@ -0,0 +1,31 @@
+/*
+ * Host mock - Emulated SSD1306 controller on the mock I2C bus
+ */
+
+#ifndef HOST_PANEL_H
+#define HOST_PANEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct HostPanelStats {
+  uint64_t transactions;   // I2C transactions addressed to the panel
+  uint64_t bytesOnBus;     // Address + control + payload bytes
+  uint64_t dataBytes;      // GDDRAM bytes written
+  uint64_t busTimeUs;      // Bus time at the configured clock (9 bits per byte)
+};
+
+// Panel GDDRAM in SSD1306 page layout (128 x 8 pages)
+const uint8_t* hostPanelGddram();
+void hostPanelReset();
+const HostPanelStats& hostPanelStats();
+void hostPanelResetStats();
+
+// When enabled, each I2C transaction advances the virtual clock by its bus
+// time, modelling the blocking Wire driver on the device.
+void hostPanelSetBlockingBus(bool blocking);
+
+// Called by the mock Wire driver for every completed transaction
+void hostPanelTransaction(uint8_t address, const uint8_t* data, size_t length, uint32_t clockHz);
+
+#endif // HOST_PANEL_H
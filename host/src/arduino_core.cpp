@@ -0,0 +1,277 @@
+/*
+ * Host mock - Minimal Arduino core for off-device builds
+ */
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <string>
+#include <chrono>
+#include "host_clock.h"
+
+static uint64_t hostNowUs = 0;
+static unsigned long hostEpochBase = 1767225600; // 2026-01-01 00:00:00 UTC
+static std::string hostSerialRx;
+static bool hostSerialMuted = false;
+static uint32_t hostCpuMhz = 80;
+static uint32_t hostRandomState = 0x12345678;
+
+HardwareSerial Serial;
+EspClass ESP;
+
+void hostSetMicros(uint64_t us) { hostNowUs = us; }
+void hostAdvanceMicros(uint64_t us) { hostNowUs += us; }
+void hostAdvanceMillis(unsigned long ms) { hostNowUs += (uint64_t)ms * 1000ULL; }
+uint64_t hostMicros() { return hostNowUs; }
+void hostSetEpoch(unsigned long epoch) { hostEpochBase = epoch; }
+unsigned long hostEpoch() { return hostEpochBase; }
+void hostSerialInput(const char* text) { hostSerialRx += text; }
+void hostSerialMute(bool mute) { hostSerialMuted = mute; }
+
+unsigned long millis() { return (unsigned long)(hostNowUs / 1000ULL); }
+unsigned long micros() { return (unsigned long)hostNowUs; }
+void delay(unsigned long ms) { hostAdvanceMillis(ms); }
+void delayMicroseconds(unsigned int us) { hostNowUs += us; }
+void yield() {}
+
+uint32_t esp_random() {
+  // xorshift32: deterministic so host runs are reproducible
+  hostRandomState ^= hostRandomState << 13;
+  hostRandomState ^= hostRandomState >> 17;
+  hostRandomState ^= hostRandomState << 5;
+  return hostRandomState;
+}
+
+bool setCpuFrequencyMhz(uint32_t mhz) { hostCpuMhz = mhz; return true; }
+uint32_t getCpuFrequencyMhz() { return hostCpuMhz; }
+
+uint32_t EspClass::getCycleCount() {
+  uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  return (uint32_t)(ns * hostCpuMhz / 1000ULL);
+}
+
+// --- String ---
+
+String::String(const char* s) : buf_(nullptr), len_(0), cap_(0) {
+  if (s && *s) concat(s);
+}
+
+String::String(const String& other) : buf_(nullptr), len_(0), cap_(0) {
+  concat(other);
+}
+
+String::String(String&& other) noexcept : buf_(other.buf_), len_(other.len_), cap_(other.cap_) {
+  other.buf_ = nullptr;
+  other.len_ = 0;
+  other.cap_ = 0;
+}
+
+String::String(char c) : buf_(nullptr), len_(0), cap_(0) { concat(c); }
+
+String::String(int value, unsigned char base) : String((long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long)value, base) {}
+
+String::String(long value, unsigned char base) : buf_(nullptr), len_(0), cap_(0) {
+  char tmp[34];
+  if (base == 16) snprintf(tmp, sizeof(tmp), "%lx", value);
+  else snprintf(tmp, sizeof(tmp), "%ld", value);
+  concat(tmp);
+}
+
+String::String(unsigned long value, unsigned char base) : buf_(nullptr), len_(0), cap_(0) {
+  char tmp[34];
+  if (base == 16) snprintf(tmp, sizeof(tmp), "%lx", value);
+  else snprintf(tmp, sizeof(tmp), "%lu", value);
+  concat(tmp);
+}
+
+String::~String() { delete[] buf_; }
+
+String& String::operator=(const String& other) {
+  if (this != &other) {
+    len_ = 0;
+    if (buf_) buf_[0] = '\0';
+    concat(other);
+  }
+  return *this;
+}
+
+String& String::operator=(String&& other) noexcept {
+  if (this != &other) {
+    delete[] buf_;
+    buf_ = other.buf_;
+    len_ = other.len_;
+    cap_ = other.cap_;
+    other.buf_ = nullptr;
+    other.len_ = 0;
+    other.cap_ = 0;
+  }
+  return *this;
+}
+
+String& String::operator=(const char* s) {
+  len_ = 0;
+  if (buf_) buf_[0] = '\0';
+  if (s) concat(s);
+  return *this;
+}
+
+bool String::reserve(unsigned int size) {
+  if (size <= cap_ && buf_) return true;
+  char* grown = new char[size + 1];
+  if (buf_) memcpy(grown, buf_, len_ + 1);
+  else grown[0] = '\0';
+  delete[] buf_;
+  buf_ = grown;
+  cap_ = size;
+  return true;
+}
+
+bool String::concat(const char* s, unsigned int n) {
+  if (n == 0) return true;
+  reserve(len_ + n);
+  memmove(buf_ + len_, s, n);
+  len_ += n;
+  buf_[len_] = '\0';
+  return true;
+}
+
+char String::charAt(unsigned int index) const {
+  return index < len_ ? buf_[index] : '\0';
+}
+
+int String::indexOf(char c, unsigned int from) const {
+  for (unsigned int i = from; i < len_; i++) {
+    if (buf_[i] == c) return (int)i;
+  }
+  return -1;
+}
+
+int String::indexOf(const char* s, unsigned int from) const {
+  if (from >= len_) return -1;
+  const char* found = strstr(buf_ + from, s);
+  return found ? (int)(found - buf_) : -1;
+}
+
+int String::lastIndexOf(char c) const {
+  return len_ == 0 ? -1 : lastIndexOf(c, len_ - 1);
+}
+
+int String::lastIndexOf(char c, unsigned int from) const {
+  if (len_ == 0) return -1;
+  if (from >= len_) from = len_ - 1;
+  for (int i = (int)from; i >= 0; i--) {
+    if (buf_[i] == c) return i;
+  }
+  return -1;
+}
+
+String String::substring(unsigned int begin, unsigned int end) const {
+  if (begin > end) std::swap(begin, end);
+  if (begin >= len_) return String();
+  if (end > len_) end = len_;
+  String out;
+  out.concat(buf_ + begin, end - begin);
+  return out;
+}
+
+void String::replace(const char* find, const char* replacement) {
+  size_t findLen = strlen(find);
+  if (len_ == 0 || findLen == 0) return;
+  size_t replLen = strlen(replacement);
+  if (strstr(c_str(), find) == nullptr) return;
+  String out;
+  const char* p = buf_;
+  const char* hit;
+  while ((hit = strstr(p, find)) != nullptr) {
+    out.concat(p, hit - p);
+    out.concat(replacement, replLen);
+    p = hit + findLen;
+  }
+  out.concat(p);
+  *this = static_cast<String&&>(out);
+}
+
+void String::trim() {
+  if (len_ == 0) return;
+  unsigned int begin = 0;
+  while (begin < len_ && isspace((unsigned char)buf_[begin])) begin++;
+  unsigned int end = len_;
+  while (end > begin && isspace((unsigned char)buf_[end - 1])) end--;
+  len_ = end - begin;
+  memmove(buf_, buf_ + begin, len_);
+  buf_[len_] = '\0';
+}
+
+void String::toLowerCase() {
+  for (unsigned int i = 0; i < len_; i++) buf_[i] = (char)tolower((unsigned char)buf_[i]);
+}
+
+void String::toUpperCase() {
+  for (unsigned int i = 0; i < len_; i++) buf_[i] = (char)toupper((unsigned char)buf_[i]);
+}
+
+String operator+(const String& a, const String& b) { String out(a); out.concat(b); return out; }
+String operator+(const String& a, const char* b) { String out(a); out.concat(b); return out; }
+String operator+(const char* a, const String& b) { String out(a); out.concat(b); return out; }
+
+// --- Print ---
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+size_t Print::print(long n, int base) {
+  char tmp[34];
+  if (base == HEX) snprintf(tmp, sizeof(tmp), "%lX", n);
+  else snprintf(tmp, sizeof(tmp), "%ld", n);
+  return write(tmp);
+}
+
+size_t Print::print(unsigned long n, int base) {
+  char tmp[34];
+  if (base == HEX) snprintf(tmp, sizeof(tmp), "%lX", n);
+  else snprintf(tmp, sizeof(tmp), "%lu", n);
+  return write(tmp);
+}
+
+size_t Print::print(double n, int digits) {
+  char tmp[48];
+  snprintf(tmp, sizeof(tmp), "%.*f", digits, n);
+  return write(tmp);
+}
+
+size_t Print::printf(const char* format, ...) {
+  char tmp[256];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(tmp, sizeof(tmp), format, args);
+  va_end(args);
+  if (n < 0) return 0;
+  if (n >= (int)sizeof(tmp)) n = sizeof(tmp) - 1;
+  return write((const uint8_t*)tmp, n);
+}
+
+// --- Serial ---
+
+int HardwareSerial::available() { return (int)hostSerialRx.size(); }
+
+int HardwareSerial::read() {
+  if (hostSerialRx.empty()) return -1;
+  int c = (unsigned char)hostSerialRx[0];
+  hostSerialRx.erase(0, 1);
+  return c;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  if (!hostSerialMuted) fputc(c, stdout);
+  return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  if (!hostSerialMuted) fwrite(buffer, 1, size, stdout);
+  return size;
+}
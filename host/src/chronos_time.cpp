@@ -0,0 +1,94 @@
+/*
+ * Host mock - ESP32Time and scriptable ChronosESP32
+ */
+
+#include <ChronosESP32.h>
+#include "host_clock.h"
+
+unsigned long ESP32Time::conversions = 0;
+
+// Offset between hostEpoch() and the time set by setTime()
+static long hostTimeAdjust = 0;
+
+void ESP32Time::setTime(unsigned long epoch, int ms) {
+  (void)ms;
+  hostTimeAdjust = (long)epoch - (long)(hostEpoch() + millis() / 1000);
+}
+
+unsigned long ESP32Time::getEpoch() {
+  return hostEpoch() + millis() / 1000 + hostTimeAdjust + offset_;
+}
+
+unsigned long ESP32Time::getMillis() { return millis() % 1000; }
+
+tm ESP32Time::getTimeStruct() {
+  time_t now = (time_t)getEpoch();
+  tm out;
+  gmtime_r(&now, &out);
+  conversions++;
+  return out;
+}
+
+int ESP32Time::getHour(bool mode) {
+  int hour = getTimeStruct().tm_hour;
+  if (mode) return hour;
+  if (hour == 0) return 12;
+  return hour > 12 ? hour - 12 : hour;
+}
+
+ChronosESP32::ChronosESP32(String name) {
+  (void)name;
+  memset(weather_, 0, sizeof(weather_));
+  navigation_.active = false;
+  navigation_.isNavigation = false;
+  navigation_.hasIcon = false;
+  memset(navigation_.icon, 0, sizeof(navigation_.icon));
+  navigation_.iconCRC = 0;
+}
+
+Weather ChronosESP32::getWeatherAt(int index) {
+  weatherReads++;
+  if (index < 0 || index >= weatherCount_) {
+    Weather empty;
+    memset(&empty, 0, sizeof(empty));
+    return empty;
+  }
+  return weather_[index];
+}
+
+void ChronosESP32::hostSetConnected(bool connected) {
+  connected_ = connected;
+  if (connectionCallback_) connectionCallback_(connected);
+}
+
+void ChronosESP32::hostSetBattery(int level) {
+  battery_ = level;
+  if (configCallback_) configCallback_(CF_PBAT, 0, (uint32_t)level);
+}
+
+void ChronosESP32::hostSetWeather(const Weather* entries, int count, const char* city) {
+  if (count > WEATHER_SIZE) count = WEATHER_SIZE;
+  for (int i = 0; i < count; i++) weather_[i] = entries[i];
+  weatherCount_ = count;
+  location_.city = city;
+  if (configCallback_) configCallback_(CF_WEATHER, 1, 0);
+}
+
+void ChronosESP32::hostSetNavigation(const Navigation& nav) {
+  bool iconChanged = nav.hasIcon && nav.iconCRC != navigation_.iconCRC;
+  navigation_ = nav;
+  if (configCallback_) {
+    configCallback_(CF_NAV_DATA, nav.active ? 1 : 0, 0);
+    if (iconChanged) configCallback_(CF_NAV_ICON, 2, nav.iconCRC);
+  }
+}
+
+void ChronosESP32::hostNotify(const char* app, const char* title, const char* message) {
+  Notification notification;
+  notification.icon = 0;
+  notification.time = "00:00";
+  notification.app = app;
+  notification.title = title;
+  notification.message = message;
+  if (notificationCallback_) notificationCallback_(notification);
+}
@@ -0,0 +1,81 @@
+/*
+ * Host mock - Preferences backed by an in-memory map of namespace/key blobs
+ */
+
+#include <Preferences.h>
+#include <map>
+#include <vector>
+#include <string.h>
+
+static std::map<std::string, std::vector<unsigned char>> hostNvs;
+
+unsigned long Preferences::writes = 0;
+unsigned long Preferences::bytesWritten = 0;
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel) {
+  (void)partitionLabel;
+  if (open_ || name == NULL || strlen(name) > 15) {
+    return false;
+  }
+  namespace_ = name;
+  readOnly_ = readOnly;
+  open_ = true;
+  return true;
+}
+
+void Preferences::end() {
+  open_ = false;
+}
+
+std::string Preferences::key(const char* name) const {
+  return namespace_ + "/" + name;
+}
+
+size_t Preferences::putBytes(const char* name, const void* value, size_t len) {
+  if (!open_ || readOnly_ || name == NULL) {
+    return 0;
+  }
+  const unsigned char* bytes = static_cast<const unsigned char*>(value);
+  hostNvs[key(name)].assign(bytes, bytes + len);
+  writes++;
+  bytesWritten += len;
+  return len;
+}
+
+size_t Preferences::getBytes(const char* name, void* buf, size_t maxLen) {
+  if (!open_ || name == NULL) {
+    return 0;
+  }
+  auto it = hostNvs.find(key(name));
+  if (it == hostNvs.end() || it->second.size() > maxLen) {
+    return 0;
+  }
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* name) {
+  if (!open_ || name == NULL) {
+    return 0;
+  }
+  auto it = hostNvs.find(key(name));
+  return it == hostNvs.end() ? 0 : it->second.size();
+}
+
+bool Preferences::remove(const char* name) {
+  if (!open_ || readOnly_ || name == NULL) {
+    return false;
+  }
+  return hostNvs.erase(key(name)) > 0;
+}
+
+bool Preferences::clear() {
+  if (!open_ || readOnly_) {
+    return false;
+  }
+  std::string prefix = namespace_ + "/";
+  for (auto it = hostNvs.begin(); it != hostNvs.end();) {
+    it = it->first.compare(0, prefix.size(), prefix) == 0 ? hostNvs.erase(it) : ++it;
+  }
+  return true;
+}
@@ -0,0 +1,170 @@
+/*
+ * Host Simulator - Runs setup()/loop() from code.ino against the host mocks
+ *
+ * Plays a scripted session (connect, weather, notification, navigation with
+ * and without a phone-supplied turn icon) on
+ * virtual time and reports frame and I2C statistics. Every loop the emulated
+ * panel GDDRAM is checked against the framebuffer.
+ *
+ * Usage: infoview_sim [--seconds N] [--dump] [--serial TEXT] [--reboot S]
+ *
+ * --serial feeds TEXT plus a newline to Serial at the end of the run and
+ * runs one more loop(), e.g. --serial lat for the latency trace.
+ * --reboot drops the phone and runs setup() again at S seconds; NVS (the
+ * Preferences mock) keeps its contents, as it would on the device.
+ */
+
+#include "code.ino"
+#include "host_clock.h"
+#include "host_panel.h"
+#include <Preferences.h>
+#include "nav_classifier.h"
+#include "nav_icon_cache.h"
+
+// Print the emulated panel contents as ASCII art
+static void dumpPanel() {
+  const uint8_t* gddram = hostPanelGddram();
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    char row[SCREEN_WIDTH + 1];
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+      row[x] = (gddram[(y / 8) * SCREEN_WIDTH + x] & (1 << (y & 7))) ? '#' : '.';
+    }
+    row[SCREEN_WIDTH] = '\0';
+    printf("%s\n", row);
+  }
+}
+
+static void startNavigation(const char* distance, const char* directions) {
+  Navigation nav = chronos.getNavigation();
+  nav.active = true;
+  nav.isNavigation = true;
+  nav.hasIcon = false;
+  nav.title = distance;
+  nav.directions = directions;
+  nav.duration = "12 mins";
+  chronos.hostSetNavigation(nav);
+}
+
+// Phone-drawn 48x48 "take the exit" icon: stem up, branch to the upper right
+static void startNavigationWithIcon(const char* distance, const char* directions) {
+  Navigation nav = chronos.getNavigation();
+  nav.active = true;
+  nav.isNavigation = true;
+  nav.title = distance;
+  nav.directions = directions;
+  nav.duration = "9 mins";
+  nav.hasIcon = true;
+  memset(nav.icon, 0, sizeof(nav.icon));
+  for (int y = 0; y < NAV_PHONE_ICON_W; y++) {
+    for (int x = 0; x < NAV_PHONE_ICON_W; x++) {
+      bool stem = x >= 14 && x < 22 && y >= 8;
+      bool branch = y >= 10 && y < 34 && abs((x - 18) - (34 - y)) < 5;
+      bool head = y >= 4 && y < 16 && x >= 30 && x < 44 && (x - 30) >= (y - 4) - 2;
+      if (stem || branch || head) nav.icon[y * (NAV_PHONE_ICON_W / 8) + x / 8] |= 0x80 >> (x & 7);
+    }
+  }
+  nav.iconCRC++;
+  chronos.hostSetNavigation(nav);
+}
+
+static void stopNavigation() {
+  Navigation nav = chronos.getNavigation();
+  nav.active = false;
+  chronos.hostSetNavigation(nav);
+}
+
+int main(int argc, char** argv) {
+  unsigned long seconds = 120;
+  bool dump = false;
+  const char* serialInput = NULL;
+  unsigned long rebootMs = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "--dump") == 0) dump = true;
+    else if (strcmp(argv[i], "--serial") == 0 && i + 1 < argc) serialInput = argv[++i];
+    else if (strcmp(argv[i], "--reboot") == 0 && i + 1 < argc) rebootMs = strtoul(argv[++i], NULL, 10) * 1000UL;
+  }
+
+  setup();
+
+  static const Weather forecast[] = {
+    {1, 0, 23, 27, 18, 1012, 5},
+    {3, 1, 20, 22, 15, 1010, 3},
+    {5, 2, 19, 21, 14, 1008, 2},
+    {0, 3, 25, 29, 19, 1014, 7},
+    {7, 4, 17, 19, 12, 1016, 1},
+  };
+
+  unsigned long loops = 0;
+  unsigned long mismatches = 0;
+  int step = 0;
+  unsigned long endMs = seconds * 1000UL;
+  bool rebooted = false;
+  bool rebootWeather = false;
+
+  while (millis() < endMs) {
+    unsigned long now = millis();
+    // Scripted session (virtual time)
+    if (step == 0 && now >= 1000) { chronos.hostSetConnected(true); chronos.hostSetBattery(72); step++; }
+    if (step == 1 && now >= 2000) { chronos.hostSetWeather(forecast, 5, "Special Region of Yogyakarta"); step++; }
+    if (step == 2 && now >= 30000) {
+      chronos.hostNotify("WhatsApp", "Budi", "Are we still on for dinner tonight? I booked the table for seven, let me know if that works for you");
+      step++;
+    }
+    if (step == 3 && now >= 45000) { startNavigation("350 m", "Turn slight right onto Jalan Malioboro"); step++; }
+    if (step == 4 && now >= 60000) { startNavigation("1.2 km", "At the roundabout take the 2nd exit"); step++; }
+    if (step == 5 && now >= 75000) { stopNavigation(); step++; }
+    if (step == 6 && now >= 90000) { startNavigationWithIcon("800 m", "Take exit 23 toward Bandara"); step++; }
+    if (step == 7 && now >= 100000) { stopNavigation(); step++; }
+
+    if (rebootMs > 0 && !rebooted && now >= rebootMs) {
+      chronos.hostSetConnected(false);
+      chronos.hostClearWeather();
+      setup();
+      rebooted = true;
+      loop();
+      rebootWeather = deviceState.weather.valid; // Ready on the first tick?
+    } else {
+      loop();
+    }
+    loops++;
+    if (memcmp(hostPanelGddram(), display.getBuffer(), SCREEN_WIDTH * SCREEN_HEIGHT / 8) != 0) {
+      mismatches++;
+    }
+  }
+
+  if (serialInput != NULL) {
+    hostSerialInput(serialInput);
+    hostSerialInput("\n");
+    loop();
+  }
+
+  const FlushStats& flush = getFlushStats();
+  const HostPanelStats& panel = hostPanelStats();
+  printf("simulated_ms=%lu loops=%lu frames=%lu unchanged_frames=%lu\n", millis(), loops, flush.frames, flush.unchangedFrames);
+  printf("flush_bytes_sent=%lu flush_bytes_saved=%lu i2c_bytes=%llu i2c_transactions=%llu i2c_bus_ms=%llu\n",
+         flush.totalBytesSent, flush.totalBytesSaved, (unsigned long long)panel.bytesOnBus,
+         (unsigned long long)panel.transactions, (unsigned long long)(panel.busTimeUs / 1000));
+  const FrameStats& sched = getFrameStats();
+  printf("missed_deadlines=%lu over_budget=%lu max_frame_us=%lu skipped_frames=%lu hash_skips=%lu region_flushes=%lu\n",
+         sched.missedDeadlines, sched.overBudget, sched.maxFrameUs, sched.skippedFrames, flush.hashSkips,
+         flush.regionFlushes);
+  const PowerStats& power = getPowerStats();
+  printf("cpu_boosts=%lu flush_boosts=%lu boosted_ms=%lu\n",
+         power.boosts, power.flushBoosts, power.boostedUs / 1000);
+  const LatencyStats& latency = getLatencyStats();
+  printf("notify_latency_traced=%lu last_us=%lu max_us=%lu\n",
+         latency.traced, latency.lastUs, latency.maxUs);
+  printf("localtime_conversions=%lu weather_reads=%lu\n", ESP32Time::conversions, chronos.weatherReads);
+  const NavClassifierStats& navClassify = getNavClassifierStats();
+  const NavIconStats& navIcons = getNavIconStats();
+  printf("nav_classify_hits=%lu nav_classify_misses=%lu nav_icon_scales=%lu nav_icon_hits=%lu\n",
+         navClassify.hits, navClassify.misses, navIcons.scales, navIcons.hits);
+  printf("nvs_writes=%lu nvs_bytes=%lu", Preferences::writes, Preferences::bytesWritten);
+  if (rebooted) printf(" weather_after_reboot=%d", rebootWeather ? 1 : 0);
+  printf("\n");
+  printf("notification_queue_bytes=%u\n", (unsigned)(sizeof(QueuedNotification) * MAX_NOTIFICATIONS));
+  printf("panel_mismatch_loops=%lu\n", mismatches);
+  if (dump) dumpPanel();
+  return mismatches == 0 ? 0 : 1;
+}
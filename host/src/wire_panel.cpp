@@ -0,0 +1,152 @@
+/*
+ * Host mock - I2C bus routed to an emulated SSD1306 panel
+ */
+
+#include <Wire.h>
+#include "host_clock.h"
+#include "host_panel.h"
+
+#define PANEL_ADDRESS 0x3C
+#define PANEL_WIDTH 128
+#define PANEL_PAGES 8
+
+TwoWire Wire;
+
+static uint8_t gddram[PANEL_WIDTH * PANEL_PAGES];
+static HostPanelStats panelStats;
+static bool blockingBus = true;
+
+// Addressing state (horizontal addressing mode)
+static uint8_t colStart = 0, colEnd = PANEL_WIDTH - 1;
+static uint8_t pageStart = 0, pageEnd = PANEL_PAGES - 1;
+static uint8_t col = 0, page = 0;
+
+// Multi-byte command parsing
+static uint8_t pendingCmd = 0;
+static uint8_t pendingArgs[6];
+static uint8_t pendingArgCount = 0;
+static uint8_t pendingArgNeeded = 0;
+
+static uint8_t commandArgCount(uint8_t cmd) {
+  switch (cmd) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x26: case 0x27:
+      return 6;
+    default:
+      return 0;
+  }
+}
+
+static void applyCommand(uint8_t cmd, const uint8_t* args) {
+  if (cmd == 0x21) {
+    colStart = args[0] & 0x7F;
+    colEnd = args[1] & 0x7F;
+    col = colStart;
+  } else if (cmd == 0x22) {
+    pageStart = args[0] & 0x07;
+    pageEnd = args[1] & 0x07;
+    page = pageStart;
+  }
+}
+
+static void feedCommand(uint8_t b) {
+  if (pendingArgNeeded > 0) {
+    pendingArgs[pendingArgCount++] = b;
+    if (pendingArgCount == pendingArgNeeded) {
+      applyCommand(pendingCmd, pendingArgs);
+      pendingArgNeeded = 0;
+    }
+    return;
+  }
+  uint8_t needed = commandArgCount(b);
+  if (needed == 0) {
+    applyCommand(b, nullptr);
+  } else {
+    pendingCmd = b;
+    pendingArgCount = 0;
+    pendingArgNeeded = needed;
+  }
+}
+
+static void feedData(uint8_t b) {
+  gddram[page * PANEL_WIDTH + col] = b;
+  panelStats.dataBytes++;
+  if (col >= colEnd) {
+    col = colStart;
+    page = (page >= pageEnd) ? pageStart : page + 1;
+  } else {
+    col++;
+  }
+}
+
+const uint8_t* hostPanelGddram() { return gddram; }
+
+void hostPanelReset() {
+  memset(gddram, 0, sizeof(gddram));
+  colStart = 0; colEnd = PANEL_WIDTH - 1;
+  pageStart = 0; pageEnd = PANEL_PAGES - 1;
+  col = 0; page = 0;
+  pendingArgNeeded = 0;
+}
+
+const HostPanelStats& hostPanelStats() { return panelStats; }
+void hostPanelResetStats() { memset(&panelStats, 0, sizeof(panelStats)); }
+void hostPanelSetBlockingBus(bool blocking) { blockingBus = blocking; }
+
+void hostPanelTransaction(uint8_t address, const uint8_t* data, size_t length, uint32_t clockHz) {
+  if (address != PANEL_ADDRESS || length == 0) return;
+  panelStats.transactions++;
+  panelStats.bytesOnBus += length + 1; // + address byte
+  // Start + stop conditions cost roughly one extra bit time each
+  uint64_t busUs = ((uint64_t)(length + 1) * 9 + 2) * 1000000ULL / (clockHz ? clockHz : 100000);
+  panelStats.busTimeUs += busUs;
+  if (blockingBus) hostAdvanceMicros(busUs);
+
+  // First byte is the control byte: Co=0, D/C# selects commands or data
+  bool isData = (data[0] & 0x40) != 0;
+  for (size_t i = 1; i < length; i++) {
+    if (isData) feedData(data[i]);
+    else feedCommand(data[i]);
+  }
+}
+
+// --- TwoWire ---
+
+bool TwoWire::begin(int sda, int scl, uint32_t frequency) {
+  (void)sda;
+  (void)scl;
+  if (frequency) clock_ = frequency;
+  return true;
+}
+
+void TwoWire::setClock(uint32_t frequency) { clock_ = frequency; }
+
+void TwoWire::beginTransmission(uint8_t address) {
+  address_ = address;
+  txLength_ = 0;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop) {
+  (void)sendStop;
+  hostPanelTransaction(address_, txBuffer_, txLength_, clock_);
+  txLength_ = 0;
+  return 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (txLength_ >= sizeof(txBuffer_)) return 0;
+  txBuffer_[txLength_++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t size) {
+  size_t n = 0;
+  while (n < size && write(data[n])) n++;
+  return n;
+}
@@ -0,0 +1,120 @@
+/*
+ * Font Generator - Builds the page-layout bitmap fonts from the classic font
+ *
+ * Both fonts are derived from the classic 5x7 GFX glyphs, so text keeps its
+ * familiar look:
+ *
+ *  - fontSmall: proportional, each glyph trimmed to its inked columns (the
+ *    space is FONT_SMALL_SPACE wide), 1 column between glyphs
+ *  - fontLarge: every glyph doubled in both directions, 10x16 with 2
+ *    columns between glyphs - the same pixels as setTextSize(2)
+ *
+ * Glyphs are stored column-wise in the SSD1306 page layout and printed as
+ * code/font_data.h to stdout.
+ *
+ * Regenerate with: cmake --build <build-dir> --target fonts
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "../src/glcdfont.h"
+#include "page_layout.h"
+
+#define FONT_FIRST 0x20
+#define FONT_LAST 0x7E
+#define FONT_SMALL_SPACE 2
+
+struct GeneratedFont {
+  std::vector<uint8_t> widths;
+  std::vector<uint16_t> offsets;
+  std::vector<uint8_t> bitmaps;
+};
+
+static GeneratedFont buildSmall() {
+  GeneratedFont font;
+  for (int c = FONT_FIRST; c <= FONT_LAST; c++) {
+    const uint8_t* glyph = glcdGlyph(c);
+    int first = 0;
+    int last = 4;
+    while (first <= last && glyph[first] == 0) first++;
+    while (last >= first && glyph[last] == 0) last--;
+
+    font.offsets.push_back(font.bitmaps.size());
+    if (first > last) {
+      // Blank glyph (the space)
+      font.widths.push_back(FONT_SMALL_SPACE);
+      font.bitmaps.insert(font.bitmaps.end(), FONT_SMALL_SPACE, 0);
+      continue;
+    }
+    font.widths.push_back(last - first + 1);
+    font.bitmaps.insert(font.bitmaps.end(), glyph + first, glyph + last + 1);
+  }
+  return font;
+}
+
+// Spread the bits of one byte over two: bit n becomes bits 2n and 2n+1
+static uint16_t doubleBits(uint8_t bits) {
+  uint16_t wide = 0;
+  for (int bit = 0; bit < 8; bit++) {
+    if (bits & (1 << bit)) {
+      wide |= 3 << (bit * 2);
+    }
+  }
+  return wide;
+}
+
+static GeneratedFont buildLarge() {
+  GeneratedFont font;
+  for (int c = FONT_FIRST; c <= FONT_LAST; c++) {
+    const uint8_t* glyph = glcdGlyph(c);
+    font.offsets.push_back(font.bitmaps.size());
+    font.widths.push_back(10);
+    // Two pages of 10 columns each
+    for (int page = 0; page < 2; page++) {
+      for (int col = 0; col < 10; col++) {
+        font.bitmaps.push_back((uint8_t)(doubleBits(glyph[col / 2]) >> (page * 8)));
+      }
+    }
+  }
+  return font;
+}
+
+static void printFont(const char* name, const GeneratedFont& font) {
+  printf("static const uint8_t PROGMEM %sWidths[] = {", name);
+  for (size_t i = 0; i < font.widths.size(); i++) {
+    printf("%s%d%s", (i % 16 == 0) ? "\n  " : "", font.widths[i], (i + 1 < font.widths.size()) ? ", " : "");
+  }
+  printf("\n};\n\n");
+
+  printf("static const uint16_t PROGMEM %sOffsets[] = {", name);
+  for (size_t i = 0; i < font.offsets.size(); i++) {
+    printf("%s%d%s", (i % 12 == 0) ? "\n  " : "", font.offsets[i], (i + 1 < font.offsets.size()) ? ", " : "");
+  }
+  printf("\n};\n\n");
+
+  std::string bitmapName = std::string(name) + "Bitmaps";
+  printBitmap(bitmapName.c_str(), font.bitmaps);
+}
+
+int main() {
+  printf("/*\n");
+  printf(" * Font Data - Glyph tables for font.cpp\n");
+  printf(" *\n");
+  printf(" * GENERATED by host/tools/gen_fonts.cpp from the classic GFX font - do not\n");
+  printf(" * edit by hand. Characters 0x%02X-0x%02X, glyph columns in page layout.\n", FONT_FIRST, FONT_LAST);
+  printf(" */\n\n");
+  printf("#ifndef FONT_DATA_H\n#define FONT_DATA_H\n\n");
+  printf("#include <Arduino.h>\n\n");
+  printf("#define FONT_DATA_FIRST 0x%02X\n", FONT_FIRST);
+  printf("#define FONT_DATA_LAST 0x%02X\n\n", FONT_LAST);
+
+  printf("// Small: proportional, 8px tall, 1 column between glyphs\n");
+  printFont("fontSmall", buildSmall());
+  printf("// Large: classic glyphs doubled, 16px tall, 2 columns between glyphs\n");
+  printFont("fontLarge", buildLarge());
+
+  printf("#endif // FONT_DATA_H\n");
+  return 0;
+}
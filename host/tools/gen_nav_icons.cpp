@@ -0,0 +1,72 @@
+/*
+ * Nav Icon Generator - Converts the navigation bitmaps to the page layout
+ *
+ * code/nav_icons.h holds the hand-drawn 32x32 arrows in row-major
+ * drawBitmap layout; this tool converts each one to the SSD1306 page layout
+ * and prints code/nav_icon_pages.h, indexed by NavManeuver, to stdout.
+ *
+ * Regenerate with: cmake --build <build-dir> --target nav_icons
+ */
+
+#include <Arduino.h>
+#include <string>
+#include "nav_icons.h"
+#include "nav_classifier.h"
+#include "page_layout.h"
+
+struct NavIconSource {
+  NavManeuver maneuver;
+  const char* name;
+  const uint8_t* bits;
+};
+
+// Bitmap per classified maneuver
+static const NavIconSource navIconSources[] = {
+  {NAV_STRAIGHT, "straight", nav_straight_bits},
+  {NAV_LEFT, "left", nav_left_bits},
+  {NAV_RIGHT, "right", nav_right_bits},
+  {NAV_SLIGHT_LEFT, "slight_left", nav_slight_left_bits},
+  {NAV_SLIGHT_RIGHT, "slight_right", nav_slight_right_bits},
+  {NAV_SHARP_LEFT, "sharp_left", nav_sharp_left_bits},
+  {NAV_SHARP_RIGHT, "sharp_right", nav_sharp_right_bits},
+  {NAV_UTURN, "uturn", nav_uturn_bits},
+  {NAV_ROUND_STRAIGHT, "round_straight", nav_round_straight_bits},
+  {NAV_ROUND_LEFT, "round_left", nav_round_left_bits},
+  {NAV_ROUND_RIGHT, "round_right", nav_round_right_bits},
+  {NAV_FORK_LEFT, "fork_left", nav_fork_left_bits},
+  {NAV_FORK_RIGHT, "fork_right", nav_fork_right_bits},
+  {NAV_MERGE, "merge", nav_merge_bits},
+  {NAV_KEEP_LEFT, "keep_left", nav_keep_left_bits},
+  {NAV_DESTINATION, "dest", nav_dest_bits},
+};
+static const int navIconCount = sizeof(navIconSources) / sizeof(navIconSources[0]);
+static_assert(sizeof(navIconSources) / sizeof(navIconSources[0]) == NAV_MANEUVER_COUNT,
+              "Every NavManeuver needs a bitmap");
+
+int main() {
+  printf("/*\n");
+  printf(" * Nav Icon Pages - Navigation bitmaps in the SSD1306 page layout\n");
+  printf(" *\n");
+  printf(" * GENERATED by host/tools/gen_nav_icons.cpp from nav_icons.h - do not\n");
+  printf(" * edit by hand. %dx%d, drawn with drawPageBitmap().\n", ICON_W, ICON_H);
+  printf(" */\n\n");
+  printf("#ifndef NAV_ICON_PAGES_H\n#define NAV_ICON_PAGES_H\n\n");
+  printf("#include <Arduino.h>\n#include \"nav_classifier.h\"\n\n");
+
+  const char* names[NAV_MANEUVER_COUNT] = {};
+  for (int i = 0; i < navIconCount; i++) {
+    const NavIconSource& icon = navIconSources[i];
+    std::string name = std::string("nav_") + icon.name + "_pages";
+    printBitmap(name.c_str(), toPageLayout(icon.bits, ICON_W, ICON_H));
+    names[icon.maneuver] = icon.name;
+  }
+
+  printf("// Lookup table: [NavManeuver]\n");
+  printf("static const uint8_t* const navIconPages[NAV_MANEUVER_COUNT] = {\n");
+  for (int m = 0; m < NAV_MANEUVER_COUNT; m++) {
+    printf("  nav_%s_pages,\n", names[m]);
+  }
+  printf("};\n\n");
+  printf("#endif // NAV_ICON_PAGES_H\n");
+  return 0;
+}
@@ -0,0 +1,232 @@
+/*
+ * Weather Icon Generator - Pre-rasterizes the weather icon atlas
+ *
+ * Draws every ChronosESP32 weather icon (codes 0-9 plus the fallback cloud)
+ * with the same primitives the firmware used to run per frame, at each atlas
+ * size and for day/night, converts it to the SSD1306 page layout and prints
+ * code/weather_icons.h to stdout.
+ *
+ * Regenerate with: cmake --build <build-dir> --target weather_icons
+ */
+
+#include <Adafruit_SSD1306.h>
+#include <string>
+#include <vector>
+#include "page_layout.h"
+
+static const int atlasSizes[] = {20, 36, 41};
+static const int atlasSizeCount = sizeof(atlasSizes) / sizeof(atlasSizes[0]);
+static const int iconSlots = 11; // Codes 0-9, slot 10 = fallback for invalid codes
+
+// Draw one icon into the canvas at (x, y). All coordinates are designed on a
+// 36px grid and scaled to size, so every icon stays inside its box.
+static void drawIcon(Adafruit_GFX& g, int icon, int x, int y, int size, bool isDay) {
+  float scale = size / 36.0f;
+  int centerX = x + size / 2;
+  int centerY = y + size / 2;
+
+  #define S(c) ((int)((c) * scale + 0.5f))
+
+  if (icon == 0 && isDay) {
+    // Clear day: sun with cardinal, diagonal and small rays
+    int sunRadius = S(10);
+    int rayOffset = S(2);
+    int rayLength = S(4);
+    g.fillCircle(centerX, centerY, sunRadius, SSD1306_WHITE);
+    g.drawCircle(centerX, centerY, S(7), SSD1306_BLACK);
+    g.drawCircle(centerX, centerY, S(6), SSD1306_BLACK);
+    g.fillRect(centerX - 1, y + rayOffset, 2, rayLength, SSD1306_WHITE);
+    g.fillRect(centerX - 1, y + size - rayOffset - rayLength, 2, rayLength, SSD1306_WHITE);
+    g.fillRect(x + rayOffset, centerY - 1, rayLength, 2, SSD1306_WHITE);
+    g.fillRect(x + size - rayOffset - rayLength, centerY - 1, rayLength, 2, SSD1306_WHITE);
+    int diagOffset = S(5);
+    int diagSize = S(2);
+    g.fillRect(x + diagOffset, y + diagOffset, diagSize, diagSize, SSD1306_WHITE);
+    g.fillRect(x + size - diagOffset - diagSize, y + size - diagOffset - diagSize, diagSize, diagSize, SSD1306_WHITE);
+    g.fillRect(x + size - diagOffset - diagSize, y + diagOffset, diagSize, diagSize, SSD1306_WHITE);
+    g.fillRect(x + diagOffset, y + size - diagOffset - diagSize, diagSize, diagSize, SSD1306_WHITE);
+    int small1 = S(8);
+    int small2 = S(3);
+    int small3 = S(27);
+    g.drawPixel(x + small1, y + small2, SSD1306_WHITE);
+    g.drawPixel(x + small3, y + small2, SSD1306_WHITE);
+    g.drawPixel(x + small2, y + small1, SSD1306_WHITE);
+    g.drawPixel(x + small2, y + small3, SSD1306_WHITE);
+    g.drawPixel(x + size - small2, y + small1, SSD1306_WHITE);
+    g.drawPixel(x + size - small2, y + small3, SSD1306_WHITE);
+    g.drawPixel(x + small1, y + size - small2, SSD1306_WHITE);
+    g.drawPixel(x + small3, y + size - small2, SSD1306_WHITE);
+  } else if (icon == 0) {
+    // Clear night: crescent moon and four small stars
+    int moonOffsetX = S(3);
+    int moonOffsetY = S(2);
+    int moonRadius = S(8);
+    g.fillCircle(centerX + moonOffsetX, centerY - moonOffsetY, moonRadius, SSD1306_WHITE);
+    g.fillCircle(centerX, centerY - moonOffsetY, moonRadius, SSD1306_BLACK);
+    const int stars[4][2] = {{6, 6}, {28, 8}, {5, 28}, {30, 30}};
+    for (int i = 0; i < 4; i++) {
+      int sx = x + S(stars[i][0]);
+      int sy = y + S(stars[i][1]);
+      g.drawPixel(sx, sy, SSD1306_WHITE);
+      g.fillRect(sx - 1, sy + 1, 3, 1, SSD1306_WHITE);
+      g.drawPixel(sx, sy + 2, SSD1306_WHITE);
+      g.fillRect(sx + 1, sy - 1, 1, 3, SSD1306_WHITE);
+    }
+  } else if (icon == 1) {
+    if (isDay) {
+      // Partly sunny: sun peeking behind a small cloud
+      g.fillCircle(x + S(9), y + S(9), S(7), SSD1306_WHITE);
+      g.fillRect(x + S(9), y + S(2), S(2), S(4), SSD1306_WHITE);
+      g.fillRect(x + S(2), y + S(9), S(4), S(2), SSD1306_WHITE);
+    } else {
+      // Partly cloudy night: crescent moon behind the cloud
+      g.fillCircle(x + S(9), y + S(9), S(7), SSD1306_WHITE);
+      g.fillCircle(x + S(6), y + S(7), S(6), SSD1306_BLACK);
+    }
+    g.fillCircle(x + S(20), y + S(20), S(6), SSD1306_WHITE);
+    g.fillCircle(x + S(27), y + S(21), S(5), SSD1306_WHITE);
+    g.fillRect(x + S(19), y + S(21), S(9), S(5), SSD1306_WHITE);
+  } else if (icon == 2 || icon == 9) {
+    // Cloudy / overcast: full cloud cover
+    g.fillCircle(x + S(9), y + S(8), S(7), SSD1306_WHITE);
+    g.fillCircle(x + S(18), y + S(8), S(8), SSD1306_WHITE);
+    g.fillCircle(x + S(27), y + S(9), S(6), SSD1306_WHITE);
+    g.fillCircle(x + S(13), y + S(11), S(5), SSD1306_WHITE);
+    g.fillRect(x + S(8), y + S(10), S(22), S(8), SSD1306_WHITE);
+  } else if (icon == 3 || icon == 4) {
+    // Light / heavy rain: cloud with vertical drops
+    g.fillCircle(x + S(9), y + S(7), S(6), SSD1306_WHITE);
+    g.fillCircle(x + S(18), y + S(7), S(7), SSD1306_WHITE);
+    g.fillCircle(x + S(26), y + S(8), S(5), SSD1306_WHITE);
+    g.fillRect(x + S(8), y + S(9), S(20), S(5), SSD1306_WHITE);
+    if (icon == 3) {
+      g.drawFastVLine(x + S(13), y + S(16), S(7), SSD1306_WHITE);
+      g.drawFastVLine(x + S(18), y + S(17), S(8), SSD1306_WHITE);
+      g.drawFastVLine(x + S(23), y + S(16), S(7), SSD1306_WHITE);
+    } else {
+      g.drawFastVLine(x + S(12), y + S(16), S(8), SSD1306_WHITE);
+      g.drawFastVLine(x + S(16), y + S(17), S(9), SSD1306_WHITE);
+      g.drawFastVLine(x + S(20), y + S(16), S(8), SSD1306_WHITE);
+      g.drawFastVLine(x + S(24), y + S(17), S(9), SSD1306_WHITE);
+    }
+  } else if (icon == 5) {
+    // Thunderstorm: cloud with a Z-shaped lightning bolt
+    g.fillCircle(x + S(10), y + S(8), S(6), SSD1306_WHITE);
+    g.fillCircle(x + S(18), y + S(7), S(7), SSD1306_WHITE);
+    g.fillCircle(x + S(25), y + S(8), S(5), SSD1306_WHITE);
+    g.fillRect(x + S(9), y + S(9), S(18), S(5), SSD1306_WHITE);
+    g.fillTriangle(x + S(17), y + S(14), x + S(20), y + S(14), x + S(18), y + S(18), SSD1306_WHITE);
+    g.fillTriangle(x + S(18), y + S(18), x + S(14), y + S(22), x + S(18), y + S(22), SSD1306_WHITE);
+    g.fillRect(x + S(17), y + S(22), max(1, S(3)), S(12), SSD1306_WHITE);
+    g.fillRect(x + S(16), y + S(28), max(1, S(2)), S(5), SSD1306_WHITE);
+  } else if (icon == 6) {
+    // Snow: small cloud with a six-arm snowflake
+    g.fillCircle(x + S(9), y + S(7), S(6), SSD1306_WHITE);
+    g.fillCircle(x + S(18), y + S(7), S(7), SSD1306_WHITE);
+    g.fillRect(x + S(8), y + S(9), S(12), S(4), SSD1306_WHITE);
+    int sx = x + S(18);
+    int sy = y + S(21);
+    int arm = S(6);
+    int thick = max(1, S(3));
+    g.fillRect(sx - thick / 2, sy - arm, thick, 2 * arm, SSD1306_WHITE);
+    g.fillRect(sx - arm, sy - thick / 2, 2 * arm, thick, SSD1306_WHITE);
+    int d1 = S(5);
+    int d2 = S(3);
+    int dot = max(1, S(2));
+    g.fillRect(sx - d1, sy - d1, dot, dot, SSD1306_WHITE);
+    g.fillRect(sx + d2, sy + d2, dot, dot, SSD1306_WHITE);
+    g.fillRect(sx + d2, sy - d1, dot, dot, SSD1306_WHITE);
+    g.fillRect(sx - d1, sy + d2, dot, dot, SSD1306_WHITE);
+  } else if (icon == 7) {
+    // Mist / fog: horizontal wavy lines
+    g.drawLine(x + S(3), y + S(9), x + S(33), y + S(11), SSD1306_WHITE);
+    g.drawLine(x + S(4), y + S(13), x + S(32), y + S(14), SSD1306_WHITE);
+    g.drawLine(x + S(3), y + S(17), x + S(33), y + S(18), SSD1306_WHITE);
+    g.drawLine(x + S(5), y + S(21), x + S(31), y + S(22), SSD1306_WHITE);
+    g.drawLine(x + S(4), y + S(25), x + S(32), y + S(26), SSD1306_WHITE);
+  } else if (icon == 8) {
+    // Drizzle: cloud with sparse dots
+    g.fillCircle(x + S(10), y + S(8), S(5), SSD1306_WHITE);
+    g.fillCircle(x + S(18), y + S(8), S(6), SSD1306_WHITE);
+    g.fillRect(x + S(9), y + S(10), S(11), S(4), SSD1306_WHITE);
+    const int drops[6][2] = {{13, 17}, {13, 20}, {18, 18}, {18, 21}, {23, 17}, {23, 20}};
+    for (int i = 0; i < 6; i++) {
+      g.drawPixel(x + S(drops[i][0]), y + S(drops[i][1]), SSD1306_WHITE);
+    }
+  } else {
+    // Fallback for invalid codes: generic cloud
+    g.fillCircle(x + S(9), y + S(8), S(7), SSD1306_WHITE);
+    g.fillCircle(x + S(18), y + S(8), S(8), SSD1306_WHITE);
+    g.fillCircle(x + S(27), y + S(9), S(6), SSD1306_WHITE);
+    g.fillRect(x + S(8), y + S(10), S(21), S(7), SSD1306_WHITE);
+  }
+
+  #undef S
+}
+
+// Rasterize one icon and return it in page layout
+static std::vector<uint8_t> rasterize(int icon, int size, bool isDay) {
+  GFXcanvas1 canvas(size, size);
+  canvas.fillScreen(0);
+  drawIcon(canvas, icon, 0, 0, size, isDay);
+  return toPageLayout(canvas.getBuffer(), size, size);
+}
+
+int main() {
+  printf("/*\n");
+  printf(" * Weather Icons - Pre-rasterized weather icon atlas\n");
+  printf(" *\n");
+  printf(" * GENERATED by host/tools/gen_weather_icons.cpp - do not edit by hand.\n");
+  printf(" * SSD1306 page-layout bitmaps (drawPageBitmap) for every ChronosESP32\n");
+  printf(" * icon code at each atlas size, with day/night variants.\n");
+  printf(" */\n\n");
+  printf("#ifndef WEATHER_ICONS_H\n#define WEATHER_ICONS_H\n\n#include <Arduino.h>\n\n");
+  printf("#define WEATHER_ICON_SLOTS %d // Codes 0-9, last slot = fallback\n", iconSlots);
+  printf("#define WEATHER_ICON_SIZES %d\n\n", atlasSizeCount);
+
+  std::string tables;
+  size_t totalBytes = 0;
+  for (int s = 0; s < atlasSizeCount; s++) {
+    int size = atlasSizes[s];
+    std::vector<std::vector<uint8_t>> unique;
+    std::vector<std::string> names;
+    std::string table = "static const uint8_t* const weather_icons_" + std::to_string(size) +
+                        "[2][WEATHER_ICON_SLOTS] = {\n";
+    for (int variant = 0; variant < 2; variant++) {
+      table += "  {";
+      for (int slot = 0; slot < iconSlots; slot++) {
+        int icon = (slot == iconSlots - 1) ? -1 : slot;
+        std::vector<uint8_t> bits = rasterize(icon, size, variant == 0);
+        size_t index = 0;
+        while (index < unique.size() && unique[index] != bits) index++;
+        if (index == unique.size()) {
+          std::string name = "weather_icon_" + std::to_string(size) + "_" +
+                             (icon < 0 ? std::string("fallback") : std::to_string(icon)) +
+                             (variant == 0 ? "" : "_night");
+          printBitmap(name.c_str(), bits);
+          unique.push_back(bits);
+          names.push_back(name);
+          totalBytes += bits.size();
+        }
+        table += names[index] + (slot + 1 < iconSlots ? ", " : "");
+      }
+      table += variant == 0 ? "}, // Day\n" : "}  // Night\n";
+    }
+    table += "};\n\n";
+    tables += table;
+  }
+
+  printf("// Lookup tables: [0 = day, 1 = night][icon code]\n");
+  printf("%s", tables.c_str());
+  printf("static const uint8_t weatherIconSizes[WEATHER_ICON_SIZES] = {");
+  for (int s = 0; s < atlasSizeCount; s++) printf("%d%s", atlasSizes[s], s + 1 < atlasSizeCount ? ", " : "");
+  printf("};\n");
+  printf("static const uint8_t* const* const weatherIconAtlas[WEATHER_ICON_SIZES] = {");
+  for (int s = 0; s < atlasSizeCount; s++) {
+    printf("&weather_icons_%d[0][0]%s", atlasSizes[s], s + 1 < atlasSizeCount ? ", " : "");
+  }
+  printf("};\n\n");
+  printf("// Atlas bitmap storage: %u bytes\n\n", (unsigned)totalBytes);
+  printf("#endif // WEATHER_ICONS_H\n");
+  return 0;
+}
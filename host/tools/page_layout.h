@@ -0,0 +1,38 @@
+/*
+ * Page Layout - Shared helpers for the bitmap generators
+ *
+ * Converts row-major MSB-first bitmaps (Adafruit drawBitmap / GFXcanvas1
+ * layout) into the SSD1306 page layout drawn by drawPageBitmap(), and
+ * prints them as PROGMEM arrays.
+ */
+
+#ifndef HOST_TOOLS_PAGE_LAYOUT_H
+#define HOST_TOOLS_PAGE_LAYOUT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+// ceil(h/8) pages of w column bytes, LSB = top row of the page
+static inline std::vector<uint8_t> toPageLayout(const uint8_t* rowMajor, int w, int h) {
+  int byteWidth = (w + 7) / 8;
+  std::vector<uint8_t> pages(w * ((h + 7) / 8), 0);
+  for (int y = 0; y < h; y++) {
+    for (int x = 0; x < w; x++) {
+      if (rowMajor[y * byteWidth + x / 8] & (0x80 >> (x & 7))) {
+        pages[(y / 8) * w + x] |= 1 << (y & 7);
+      }
+    }
+  }
+  return pages;
+}
+
+static inline void printBitmap(const char* name, const std::vector<uint8_t>& bits) {
+  printf("static const uint8_t PROGMEM %s[] = {", name);
+  for (size_t i = 0; i < bits.size(); i++) {
+    printf("%s0x%02X%s", (i % 16 == 0) ? "\n  " : "", bits[i], (i + 1 < bits.size()) ? ", " : "");
+  }
+  printf("\n};\n\n");
+}
+
+#endif // HOST_TOOLS_PAGE_LAYOUT_H